@@ -0,0 +1,131 @@
+//job periodico che pubblica SystemStats: write DDS nel job (sincrona) contro push in AsyncPublishStage
+//con la write nel thread writer a priorità più bassa su un altro core (asincrona). Il job riempie un
+//SystemStatsPlain (niente stringhe, il push non alloca), la conversione in SystemStats la fa chi scrive.
+//Per ogni modo: tempo di risposta del job (dall'attivazione reale alla fine del lavoro) e jitter di risveglio,
+//media, percentili e massimo. Publisher e subscriber sono due participant dello stesso processo senza consegna
+//intraprocesso, quindi la write serializza e spedisce davvero. Per SCHED_FIFO serve sudo
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <time.h>
+#include <sys/mman.h>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryLoan.hpp"
+#include "AsyncPublish.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+// il subscriber svuota il reader finché il job non ha finito, così la storia del writer non si riempie
+void drain_task(DataReader *reader, std::atomic<bool> *running) {
+	SystemStats sample;
+	SampleInfo info;
+	while (running->load()) {
+		if (!reader->wait_for_unread_message(Duration_t(0, 100000000))) continue;
+		while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {}
+	}
+}
+
+struct JobConfig {
+	long samples = 20000;
+	long period_us = 1000;
+	int job_core = 0;
+	int job_priority = 0;
+	int writer_core = 1;
+};
+
+struct RunResult {
+	LatencyHistogram response;
+	LatencyHistogram jitter;
+	long dropped = 0;
+};
+
+// Il job: attivazione periodica, riempie il campione e lo pubblica (o lo mette in coda)
+void job_task(const JobConfig *cfg, JobPublisher<SystemStatsPlain> *publisher, RunResult *r) {
+	pin_current_thread(cfg->job_core, cfg->job_priority);
+	SystemStatsPlain stats{};
+	stats.speed(100.0f);
+	set_status_msg(stats, "NOMINAL FLIGHT");
+
+	struct timespec next, start, end;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < cfg->samples; i++) {
+		timespec_add_ns(&next, cfg->period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		stats.packet_id((uint32_t) i);
+		stats.altitude(5000.0f + (i % 1000));
+		publisher->publish(stats);
+
+		clock_gettime(CLOCK_MONOTONIC, &end);
+		r->response.record((uint64_t) timespec_diff_ns(start, end));
+		long late = timespec_diff_ns(next, start);
+		r->jitter.record(late > 0 ? (uint64_t) late : 0);
+	}
+}
+
+RunResult run(const JobConfig &cfg, bool async) {
+	RunResult r;
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	Endpoints e = create_endpoints("AsyncBench", transport_profile_from_env(), [] { return new SystemStatsPubSubType(); },
+			"TelemetryTopic", wqos, rqos);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	std::atomic<bool> running{true};
+	std::thread sub(drain_task, e.reader, &running);
+
+	// il writer sta sotto al job: SCHED_FIFO 1 se il job è FIFO, altrimenti SCHED_OTHER come il job
+	DataWriter *writer = e.writer;
+	SystemStats copy; // lo usa solo chi fa la write (il job o il thread writer)
+	JobPublisher<SystemStatsPlain> publisher([writer, &copy](const SystemStatsPlain &s) {
+		copy_telemetry(s, copy);
+		writer->write(&copy);
+	}, async, cfg.writer_core, cfg.job_priority > 1 ? 1 : 0);
+
+	std::thread job(job_task, &cfg, &publisher, &r);
+	job.join();
+	publisher.finish();
+	r.dropped = publisher.dropped_count();
+
+	running.store(false);
+	sub.join();
+	delete_endpoints(e);
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: sudo ./AsyncPublishBench [campioni] [periodo_us] [core_job] [prio_job] [core_writer]
+	JobConfig cfg;
+	if (argc > 1) cfg.samples = std::stol(argv[1]);
+	if (argc > 2) cfg.period_us = std::stol(argv[2]);
+	if (argc > 3) cfg.job_core = std::stoi(argv[3]);
+	if (argc > 4) cfg.job_priority = std::stoi(argv[4]);
+	if (argc > 5) cfg.writer_core = std::stoi(argv[5]);
+	if (cfg.job_priority > 0) mlockall(MCL_CURRENT | MCL_FUTURE);
+
+	bench_library_settings();
+
+	std::cout << "--- Job a " << cfg.period_us << " us per " << cfg.samples << " campioni (core " << cfg.job_core
+			<< ", prio " << cfg.job_priority << "), writer asincrono sul core " << cfg.writer_core << " ---\n";
+	for (bool async : { false, true }) {
+		RunResult r = run(cfg, async);
+		const char *mode = async ? "asincrona" : "sincrona";
+		print_latency_row((std::string(mode) + " risposta").c_str(), r.response, 1000.0, "us");
+		print_latency_row((std::string(mode) + " jitter").c_str(), r.jitter, 1000.0, "us");
+		std::printf("%-22s media risposta %.2f us, jitter %.2f us, %ld scartati\n", "", r.response.mean_ns() / 1000.0,
+				r.jitter.mean_ns() / 1000.0, r.dropped);
+	}
+	std::cout << "(risposta: dal risveglio del job alla fine della write o del push; jitter: risveglio reale - attivazione)\n";
+	return 0;
+}
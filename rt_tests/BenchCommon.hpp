@@ -0,0 +1,157 @@
+//parte comune dei benchmark DDS di rt_tests (DDSLoanBench, TelemetryBatchBench, TransportBench, AsyncPublishBench,
+//StatisticsBench, FleetTelemetryBench, ReaderModeBench): publisher e subscriber sono due participant dello stesso
+//processo sul dominio 1, così l'orologio è uno solo. Qui orologi e CPU, creazione e scoperta di writer e reader,
+//il subscriber che segna l'arrivo di ogni packet_id e l'istogramma della latenza write -> take
+#ifndef BENCH_COMMON_HPP
+#define BENCH_COMMON_HPP
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <time.h>
+#include <sys/resource.h>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include "LatencyHistogram.hpp"
+#include "RtThread.hpp"
+#include "TransportProfile.hpp"
+
+inline long now_ns() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+// tempo di CPU (utente + sistema) in microsecondi: RUSAGE_SELF tutto il processo, RUSAGE_THREAD il thread chiamante
+inline long cpu_us(int who) {
+	struct rusage ru;
+	getrusage(who, &ru);
+	return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000L + ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+}
+
+// Prima di creare i participant: senza questo i due participant dello stesso processo si parlerebbero con la
+// consegna intraprocesso. FBW_TRANSPORT=intra la riaccende
+inline void bench_library_settings() {
+	eprosima::fastdds::LibrarySettings settings;
+	settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+	eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->set_library_settings(settings);
+	select_transport_library(transport_profile_from_env());
+}
+
+struct Endpoints {
+	eprosima::fastdds::dds::DomainParticipant *pub_participant = nullptr;
+	eprosima::fastdds::dds::DomainParticipant *sub_participant = nullptr;
+	eprosima::fastdds::dds::DataWriter *writer = nullptr;
+	eprosima::fastdds::dds::DataReader *reader = nullptr;
+};
+
+// Participant name_Pub e name_Sub con il profilo di trasporto, writer e reader di topic_name con le QoS date.
+// make_type() crea il tipo, una volta per participant; listener e mask vanno al reader.
+// Se qualcosa non si crea writer o reader restano nullptr, delete_endpoints va chiamata comunque
+template <typename MakeType>
+Endpoints create_endpoints(const std::string &name, TransportProfile profile, MakeType make_type, const char *topic_name,
+		const eprosima::fastdds::dds::DataWriterQos &wqos, const eprosima::fastdds::dds::DataReaderQos &rqos,
+		eprosima::fastdds::dds::DataReaderListener *listener = nullptr,
+		const eprosima::fastdds::dds::StatusMask &mask = eprosima::fastdds::dds::StatusMask::all()) {
+	using namespace eprosima::fastdds::dds;
+	Endpoints e;
+	DomainParticipantQos pqos;
+	apply_transport_profile(pqos, profile);
+	pqos.name(name + "_Pub");
+	e.pub_participant = DomainParticipantFactory::get_instance()->create_participant(1, pqos);
+	pqos.name(name + "_Sub");
+	e.sub_participant = DomainParticipantFactory::get_instance()->create_participant(1, pqos);
+	if (e.pub_participant == nullptr || e.sub_participant == nullptr) return e;
+
+	TypeSupport pub_type(make_type());
+	pub_type.register_type(e.pub_participant);
+	Topic *pub_topic = e.pub_participant->create_topic(topic_name, pub_type.get_type_name(), TOPIC_QOS_DEFAULT);
+	e.writer = e.pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(pub_topic, wqos);
+
+	TypeSupport sub_type(make_type());
+	sub_type.register_type(e.sub_participant);
+	Topic *sub_topic = e.sub_participant->create_topic(topic_name, sub_type.get_type_name(), TOPIC_QOS_DEFAULT);
+	e.reader = e.sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(sub_topic, rqos, listener, mask);
+	return e;
+}
+
+inline void delete_endpoints(Endpoints &e) {
+	using namespace eprosima::fastdds::dds;
+	for (DomainParticipant *p : { e.pub_participant, e.sub_participant }) {
+		if (p == nullptr) continue;
+		p->delete_contained_entities();
+		DomainParticipantFactory::get_instance()->delete_participant(p);
+	}
+}
+
+// false (con il messaggio) se writer o reader mancano; altrimenti aspetta la scoperta, al massimo 5 s,
+// così i primi campioni hanno un lettore. I 200 ms dopo servono al reader per vedere il writer
+inline bool wait_for_match(Endpoints &e) {
+	if (e.writer == nullptr || e.reader == nullptr) {
+		std::cerr << "Errore DDS Writer/Reader\n";
+		return false;
+	}
+	eprosima::fastdds::dds::PublicationMatchedStatus matched;
+	for (int waited = 0; waited < 5000; waited += 10) {
+		e.writer->get_publication_matched_status(matched);
+		if (matched.current_count > 0) break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	return true;
+}
+
+// segna in recv_ns l'istante t per packet_id, 1 se è nuovo e dentro il vettore
+inline long mark_arrival(std::vector<long> &recv_ns, uint32_t packet_id, long t) {
+	if (packet_id >= recv_ns.size() || recv_ns[packet_id] != 0) return 0;
+	recv_ns[packet_id] = t;
+	return 1;
+}
+
+// Subscriber: take_next_sample di T e mark(campione) per ogni campione valido, mark restituisce quanti packet_id
+// ha segnato (più d'uno per i batch). Si ferma quando sono arrivati tutti quelli di recv_ns o dopo 1 s senza campioni
+template <typename T, typename Mark>
+void receive_samples(eprosima::fastdds::dds::DataReader *reader, const std::vector<long> &recv_ns, Mark mark) {
+	using namespace eprosima::fastdds::dds;
+	long count = 0;
+	long total = (long) recv_ns.size();
+	T sample;
+	SampleInfo info;
+	while (count < total && reader->wait_for_unread_message(Duration_t(1, 0))) {
+		while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {
+			if (info.valid_data) count += mark(sample);
+		}
+	}
+}
+
+// il caso più comune: un packet_id per campione, istante preso alla take
+template <typename T>
+void subscriber_task(eprosima::fastdds::dds::DataReader *reader, std::vector<long> *recv_ns) {
+	receive_samples<T>(reader, *recv_ns, [recv_ns](const T &sample) {
+		return mark_arrival(*recv_ns, sample.packet_id(), now_ns());
+	});
+}
+
+// latenza write -> take dei campioni arrivati (recv_ns != 0)
+inline LatencyHistogram arrival_latency(const std::vector<long> &send_ns, const std::vector<long> &recv_ns) {
+	LatencyHistogram latency;
+	for (size_t i = 0; i < send_ns.size() && i < recv_ns.size(); i++) {
+		if (recv_ns[i] != 0) latency.record((uint64_t) (recv_ns[i] - send_ns[i]));
+	}
+	return latency;
+}
+
+#endif
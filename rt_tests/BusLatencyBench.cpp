@@ -0,0 +1,110 @@
+//confronto della latenza scrittura -> lettura dei bus FlightControls:
+//thread dello stesso processo (SharedMemoryBus, SeqLockBus, SpscRingBus) contro due processi con ProcessSharedBus
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <thread>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include "SharedMemory.hpp"
+#include "ProcessSharedBus.hpp"
+
+#define BENCH_SHM_NAME "/fbw_bus_bench"
+
+void timespec_add_us(struct timespec *t, long us) {
+	t->tv_sec += us / 1000000;
+	t->tv_nsec += (us % 1000000) * 1000;
+	if (t->tv_nsec >= 1000000000) {
+		t->tv_sec++;
+		t->tv_nsec -= 1000000000;
+	}
+}
+
+void print_latency(const std::string& name, std::vector<double>& lat_us, long expected) {
+	if (lat_us.empty()) {
+		std::cout << std::left << std::setw(12) << name << " nessun campione ricevuto\n";
+		return;
+	}
+	std::sort(lat_us.begin(), lat_us.end());
+	auto pct = [&](double p) { return lat_us[(size_t)(p * (lat_us.size() - 1))]; };
+
+	std::cout << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(2)
+			<< " rx:" << std::setw(6) << lat_us.size() << "/" << expected
+			<< " | p50:" << std::setw(8) << pct(0.50)
+			<< " | p99:" << std::setw(8) << pct(0.99)
+			<< " | p99.9:" << std::setw(8) << pct(0.999)
+			<< " | max:" << std::setw(8) << lat_us.back() << " us\n";
+}
+
+// il lettore prende campioni finché il writer non ha finito e per 200 ms non arriva più niente
+template <typename Bus>
+void reader_loop(Bus& bus, long samples, std::vector<double>& lat_us) {
+	FlightControls c;
+	lat_us.reserve(samples);
+	while ((long) lat_us.size() < samples && bus.read_with_timeout(c, 200)) {
+		lat_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - c.timestamp).count());
+	}
+}
+
+template <typename Bus>
+void writer_loop(Bus& bus, long samples, long period_us) {
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_us(&next, period_us);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		bus.write(i, 0.1f, 0.2f, 0.3f, 4000.0f, false, 100.0f, 0.0f, 0.0f, false);
+	}
+}
+
+template <typename Bus>
+void bench_in_process(long samples, long period_us) {
+	static Bus bus; // static perché la coda circolare è grande
+	std::vector<double> lat_us;
+	std::thread reader(reader_loop<Bus>, std::ref(bus), samples, std::ref(lat_us));
+	writer_loop(bus, samples, period_us);
+	reader.join();
+	print_latency(Bus::name, lat_us, samples);
+}
+
+void bench_cross_process(long samples, long period_us) {
+	ProcessSharedBus bus(BENCH_SHM_NAME, true);
+	if (!bus.is_open()) return;
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		// figlio = computer di volo
+		ProcessSharedBus child_bus(BENCH_SHM_NAME, false);
+		std::vector<double> lat_us;
+		reader_loop(child_bus, samples, lat_us);
+		print_latency(ProcessSharedBus::name, lat_us, samples);
+		std::cout.flush(); // _exit non svuota i buffer
+		_exit(0);
+	}
+
+	usleep(100000); // lascio al figlio il tempo di mettersi in attesa
+	writer_loop(bus, samples, period_us);
+	bus.close_writer();
+	waitpid(pid, NULL, 0);
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./BusLatencyBench [campioni] [periodo_us]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 5000;
+	long period_us = (argc > 2) ? std::stol(argv[2]) : 1000;
+
+	mlockall(MCL_CURRENT | MCL_FUTURE);
+
+	std::cout << "--- Latenza bus FlightControls: " << samples << " campioni ogni " << period_us << " us ---\n";
+	bench_in_process<SharedMemoryBus>(samples, period_us);
+	bench_in_process<SeqLockBus>(samples, period_us);
+	bench_in_process<SpscRingBus<1024>>(samples, period_us);
+	std::cout.flush();
+	bench_cross_process(samples, period_us);
+	return 0;
+}
@@ -0,0 +1,172 @@
+//parte DDS comune ai test real-time DDSCORE, DDSMCORE, DDSEDFSCORE e DDSEDFMCORE: participant sul dominio 1
+//(quello del Fast DDS Monitor), un writer e un reader della telemetria nello stesso processo.
+//Il percorso lo sceglie cmake con -DFLIGHT_TELEMETRY= come per FlightSim e MonitorApp:
+//  COPY  SystemStats su TelemetryTopic, write() e take_next_sample() con copia
+//  LOAN  SystemStatsPlain su TelemetryPlainTopic, campione prestato dal writer (loan_sample), letto in prestito
+//        con take() e consegnato con data-sharing (non con FBW_TRANSPORT=udp)
+//Il Subscriber legge come sceglie FBW_READER (come per MonitorApp, con FBW_READER_BATCH, _CORE e _PRIORITY):
+//  poll     (default) ogni job prende i campioni uno alla volta
+//  batch    ogni job li prende a gruppi in prestito con take_batch
+//  waitset  un thread WaitSetReader li prende appena arrivano, il job legge solo l'ultima quota
+#ifndef DDS_HARNESS_HPP
+#define DDS_HARNESS_HPP
+
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryLoan.hpp"
+#include "TransportProfile.hpp"
+#include "WaitSetReader.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+enum class HarnessReader { POLL, BATCH, WAITSET };
+
+class DDSHarness {
+    eprosima::fastdds::dds::DomainParticipant* participant = nullptr;
+    SystemStats copy_out; // COPY: campione del Publisher
+    SystemStats copy_in;  // COPY: campione del Subscriber
+    int32_t batch = READER_DEFAULT_BATCH;
+    WaitSetReader waitset_reader;
+    std::atomic<float> latest_altitude{0.0f}; // waitset: ultima quota presa dal thread
+    std::atomic<bool> fresh{false};           // waitset: quota non ancora letta dal job
+
+    static int env_int(const char* name, int fallback) {
+        const char* env = std::getenv(name);
+        return env != nullptr ? std::atoi(env) : fallback;
+    }
+
+    // batch e waitset: tutto quello che c'è a gruppi in prestito, in altitude l'ultima quota valida
+    template <typename T>
+    bool take_all(float& altitude) {
+        bool got = false;
+        take_batch<T>(reader, batch, [&](const T& sample, const eprosima::fastdds::dds::SampleInfo& info, bool) {
+            if (!info.valid_data) return;
+            altitude = sample.altitude();
+            got = true;
+        });
+        return got;
+    }
+
+public:
+    eprosima::fastdds::dds::DataWriter* writer = nullptr;
+    eprosima::fastdds::dds::DataReader* reader = nullptr;
+    HarnessReader mode = HarnessReader::POLL;
+
+    // false se participant, writer o reader non si creano
+    bool init(const char* participant_name) {
+        using namespace eprosima::fastdds::dds;
+        TransportProfile transport = transport_profile_from_env();
+        DomainParticipantQos pqos;
+        pqos.name(participant_name);
+        // FBW_TRANSPORT=shm|udp|intra, senza restano i trasporti di Fast DDS (intraprocesso compreso)
+        setup_transport(pqos, transport);
+        participant = DomainParticipantFactory::get_instance()->create_participant(1, pqos);
+        if (participant == nullptr) return false;
+
+        TypeSupport type(TELEMETRY_LOAN ? static_cast<TopicDataType*>(new SystemStatsPlainPubSubType())
+                                        : new SystemStatsPubSubType());
+        type.register_type(participant);
+        Topic* topic = participant->create_topic(TELEMETRY_LOAN ? TELEMETRY_PLAIN_TOPIC : TELEMETRY_TOPIC,
+                                                 type.get_type_name(), TOPIC_QOS_DEFAULT);
+
+        DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+        DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+        if (TELEMETRY_LOAN && transport_allows_data_sharing(transport)) {
+            enable_data_sharing(wqos);
+            enable_data_sharing(rqos);
+        }
+        Publisher* pub = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        writer = pub->create_datawriter(topic, wqos);
+        Subscriber* sub = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        reader = sub->create_datareader(topic, rqos);
+        if (writer == nullptr || reader == nullptr) return false;
+
+        const char* env = std::getenv("FBW_READER");
+        if (env != nullptr && std::strcmp(env, "batch") == 0) mode = HarnessReader::BATCH;
+        else if (env != nullptr && std::strcmp(env, "waitset") == 0) mode = HarnessReader::WAITSET;
+        batch = env_int("FBW_READER_BATCH", READER_DEFAULT_BATCH);
+        if (batch <= 0) batch = READER_DEFAULT_BATCH;
+        if (mode == HarnessReader::WAITSET) {
+            waitset_reader.attach(reader, [this](DataReader*) {
+                float altitude;
+                bool got = TELEMETRY_LOAN ? take_all<SystemStatsPlain>(altitude) : take_all<SystemStats>(altitude);
+                if (!got) return;
+                latest_altitude.store(altitude);
+                fresh.store(true);
+            });
+            waitset_reader.start(env_int("FBW_READER_CORE", -1), env_int("FBW_READER_PRIORITY", 0));
+        }
+        return true;
+    }
+
+    const char* reader_mode_name() const {
+        return mode == HarnessReader::BATCH ? "batch" : mode == HarnessReader::WAITSET ? "waitset" : "poll";
+    }
+
+    // Publisher: con LOAN si scrive direttamente nel campione prestato, con COPY si serializza SystemStats
+    bool publish(const SystemStatsPlain& sample) {
+        using namespace eprosima::fastdds::dds;
+        if (TELEMETRY_LOAN) {
+            void* loaned = nullptr;
+            if (writer->loan_sample(loaned) != RETCODE_OK) return false; // il lettore tiene ancora tutti i campioni
+            *static_cast<SystemStatsPlain*>(loaned) = sample;
+            if (writer->write(loaned) != RETCODE_OK) {
+                writer->discard_loan(loaned);
+                return false;
+            }
+            return true;
+        }
+        copy_telemetry(sample, copy_out);
+        return writer->write(&copy_out) == RETCODE_OK;
+    }
+
+    // Subscriber: prende tutto quello che è arrivato, in altitude la quota dell'ultimo campione valido.
+    // false se non c'era niente di nuovo (con waitset: nulla dopo l'ultima chiamata)
+    bool take_latest_altitude(float& altitude) {
+        using namespace eprosima::fastdds::dds;
+        if (mode == HarnessReader::WAITSET) {
+            if (!fresh.exchange(false)) return false;
+            altitude = latest_altitude.load();
+            return true;
+        }
+        if (mode == HarnessReader::BATCH) {
+            return TELEMETRY_LOAN ? take_all<SystemStatsPlain>(altitude) : take_all<SystemStats>(altitude);
+        }
+        bool got = false;
+        if (TELEMETRY_LOAN) {
+            LoanableSequence<SystemStatsPlain> data;
+            SampleInfoSeq infos;
+            while (reader->take(data, infos) == RETCODE_OK) {
+                for (int32_t i = 0; i < data.length(); i++) {
+                    if (!infos[i].valid_data) continue;
+                    altitude = data[i].altitude();
+                    got = true;
+                }
+                reader->return_loan(data, infos);
+            }
+            return got;
+        }
+        SampleInfo info;
+        while (reader->take_next_sample(&copy_in, &info) == RETCODE_OK) {
+            if (!info.valid_data) continue;
+            altitude = copy_in.altitude();
+            got = true;
+        }
+        return got;
+    }
+};
+
+#endif
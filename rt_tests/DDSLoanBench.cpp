@@ -0,0 +1,144 @@
+//latenza end-to-end e CPU della telemetria DDS: SystemStats con copia (serializzato e passato dal trasporto
+//in memoria condivisa) contro SystemStatsPlain prestato dal writer (loan_sample) e consegnato con data-sharing.
+//Publisher e subscriber sono due participant dello stesso processo con la consegna intraprocesso spenta:
+//i campioni fanno la stessa strada che fanno fra FlightSim e MonitorApp, ma l'orologio è uno solo
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <time.h>
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryLoan.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+Endpoints create_loan_endpoints(bool loan) {
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	if (loan) {
+		enable_data_sharing(wqos);
+		enable_data_sharing(rqos);
+	} else {
+		// stessa profondità della storia, ma passa dal trasporto
+		wqos.data_sharing().off();
+		rqos.data_sharing().off();
+		wqos.history().depth = TELEMETRY_PLAIN_DEPTH;
+		rqos.history().depth = TELEMETRY_PLAIN_DEPTH;
+	}
+	return create_endpoints(loan ? "LoanBench_Loan" : "LoanBench_Copy", transport_profile_from_env(), [loan] {
+		return loan ? static_cast<TopicDataType*>(new SystemStatsPlainPubSubType()) : new SystemStatsPubSubType();
+	}, loan ? TELEMETRY_PLAIN_TOPIC : TELEMETRY_TOPIC, wqos, rqos);
+}
+
+struct RunResult {
+	LatencyHistogram latency;
+	double cpu_process_us = 0; // per campione, tutti i thread (anche quelli interni di Fast DDS)
+	double cpu_pub_us = 0;     // per campione, solo il thread che pubblica
+	double cpu_sub_us = 0;     // per campione, solo il thread che legge
+};
+
+// Il subscriber segna l'istante di arrivo di ogni packet_id, si ferma dopo 1 s senza campioni
+void loan_subscriber_task(DataReader *reader, bool loan, std::vector<long> *recv_ns, long *cpu) {
+	long cpu_start = cpu_us(RUSAGE_THREAD);
+	if (loan) {
+		long count = 0;
+		LoanableSequence<SystemStatsPlain> data;
+		SampleInfoSeq infos;
+		while (count < (long) recv_ns->size() && reader->wait_for_unread_message(Duration_t(1, 0))) {
+			while (reader->take(data, infos) == RETCODE_OK) {
+				long t = now_ns();
+				for (int32_t i = 0; i < data.length(); i++) {
+					if (infos[i].valid_data) count += mark_arrival(*recv_ns, data[i].packet_id(), t);
+				}
+				reader->return_loan(data, infos);
+			}
+		}
+	} else {
+		subscriber_task<SystemStats>(reader, recv_ns);
+	}
+	*cpu = cpu_us(RUSAGE_THREAD) - cpu_start;
+}
+
+RunResult run(bool loan, long samples, long period_us) {
+	RunResult r;
+	Endpoints e = create_loan_endpoints(loan);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	std::vector<long> send_ns(samples, 0), recv_ns(samples, 0);
+	long sub_cpu = 0;
+	long process_cpu_start = cpu_us(RUSAGE_SELF);
+	long pub_cpu_start = cpu_us(RUSAGE_THREAD);
+	std::thread sub(loan_subscriber_task, e.reader, loan, &recv_ns, &sub_cpu);
+
+	SystemStats stats;
+	stats.status_msg("NOMINAL FLIGHT");
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_ns(&next, period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		float altitude = 5000.0f + (i % 1000);
+		send_ns[i] = now_ns();
+
+		if (loan) {
+			void *sample = nullptr;
+			if (e.writer->loan_sample(sample) != RETCODE_OK) continue; // il lettore tiene ancora tutti i campioni
+			SystemStatsPlain *plain = static_cast<SystemStatsPlain*>(sample);
+			plain->packet_id((uint32_t) i);
+			plain->roll(0.1f);
+			plain->pitch(0.05f);
+			plain->yaw(0.0f);
+			plain->altitude(altitude);
+			plain->latency_us(0.0f);
+			plain->speed(100.0f);
+			plain->deadline_missed(false);
+			set_status_msg(*plain, "NOMINAL FLIGHT");
+			if (e.writer->write(sample) != RETCODE_OK) e.writer->discard_loan(sample);
+		} else {
+			stats.packet_id((uint32_t) i);
+			stats.roll(0.1f);
+			stats.pitch(0.05f);
+			stats.altitude(altitude);
+			stats.speed(100.0f);
+			e.writer->write(&stats);
+		}
+	}
+	long pub_cpu = cpu_us(RUSAGE_THREAD) - pub_cpu_start;
+	sub.join();
+	long process_cpu = cpu_us(RUSAGE_SELF) - process_cpu_start;
+
+	r.latency = arrival_latency(send_ns, recv_ns);
+	r.cpu_process_us = (double) process_cpu / samples;
+	r.cpu_pub_us = (double) pub_cpu / samples;
+	r.cpu_sub_us = (double) sub_cpu / samples;
+
+	delete_endpoints(e);
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./DDSLoanBench [campioni] [periodo_us]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 20000;
+	long period_us = (argc > 2) ? std::stol(argv[2]) : 500;
+
+	bench_library_settings();
+
+	std::cout << "--- Telemetria DDS: " << samples << " campioni ogni " << period_us << " us (dominio 1) ---\n";
+	const char *names[2] = { "copia (SHM)", "prestito (data-sharing)" };
+	for (int mode = 0; mode < 2; mode++) {
+		RunResult r = run(mode == 1, samples, period_us);
+		print_latency_row(names[mode], r.latency, 1000.0, "us");
+		std::printf("%-22s media %.1f us, CPU proc %.2f us/c, pub %.2f us/c, sub %.2f us/c\n", "",
+				r.latency.mean_ns() / 1000.0, r.cpu_process_us, r.cpu_pub_us, r.cpu_sub_us);
+	}
+	std::cout << "(latenza: write -> take nel subscriber; CPU in microsecondi per campione)\n";
+	return 0;
+}
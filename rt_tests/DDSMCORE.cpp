@@ -20,6 +20,10 @@
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include "Telemetry.hpp"
 #include "TelemetryPubSubTypes.hpp"
+#include "TransportProfile.hpp"
+#include "AsyncPublish.hpp"
+#include "DDSHarness.hpp"
+#include "LatencyHistogram.hpp"
 
 using namespace eprosima::fastdds::dds;
 
@@ -38,8 +42,9 @@ typedef struct arg {
 	int final_jitter_violations;
 	int final_deadline_misses;
 
-	DataWriter *writer; // Usato dal Publisher
-	DataReader *reader; // Usato dal Subscriber
+	DDSHarness *dds; // writer per il Publisher, reader per il Subscriber
+	JobPublisher<SystemStatsPlain> *publisher; // write nel job del Publisher, con "async" solo il push
+	JobResponse response;
 } t_arg;
 
 void* Task(void *ptr);
@@ -70,35 +75,22 @@ void burn_cpu(long ms) {
 int main(int argc, char *argv[]) {
 
 	if (argc < 5) {
-		std::cerr << "USO: sudo ./rt_dds_scheduler P_Pub D_Pub P_Sub D_Sub\n";
+		std::cerr << "USO: sudo ./rt_dds_scheduler P_Pub D_Pub P_Sub D_Sub [async]\n";
 		exit(1);
 	}
 
-	DomainParticipantQos pqos;
-	pqos.name("RT_Scheduler_Participant");
-	DomainParticipant *participant =
-			DomainParticipantFactory::get_instance()->create_participant(1,
-					pqos); //settato sul dominio 1 del fast dds monitor per valutarne l'andamento
-	if (participant == nullptr) {
-		std::cerr << "Errore DDS Participant\n";
-		return 1;
-	}
-
-	TypeSupport type(new SystemStatsPubSubType());
-	type.register_type(participant);
-	Topic *topic = participant->create_topic("TelemetryTopic",
-			type.get_type_name(), TOPIC_QOS_DEFAULT);
-
-	Publisher *pub = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
-	DataWriter *writer = pub->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
-
-	Subscriber *sub = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
-	DataReader *reader = sub->create_datareader(topic, DATAREADER_QOS_DEFAULT);
-
-	if (writer == nullptr || reader == nullptr) {
-		std::cerr << "Errore DDS Writer/Reader\n";
+	// telemetria COPY o LOAN come da cmake (-DFLIGHT_TELEMETRY=), trasporto da FBW_TRANSPORT,
+	// lettura del Subscriber da FBW_READER=poll|batch|waitset
+	DDSHarness dds;
+	if (!dds.init("RT_Scheduler_Participant")) {
+		std::cerr << "Errore DDS Participant/Writer/Reader\n";
 		return 1;
 	}
+	// async: la write DDS esce dal job del Publisher e va a un thread writer SCHED_FIFO 1 sul core 1
+	bool async = argc > 5 && std::string(argv[5]) == "async";
+	JobPublisher<SystemStatsPlain> publisher([&dds](const SystemStatsPlain &s) { dds.publish(s); }, async, 1, 1);
+	if (async) std::cout << "Pubblicazione asincrona: thread writer sul core 1, SCHED_FIFO 1\n";
+	std::cout << "Lettura del Subscriber: " << dds.reader_mode_name() << "\n";
 	std::cout << "Rete DDS pronta. Avvio Thread Real-Time...\n\n";
 
 	//creo ambiente per thread
@@ -135,8 +127,9 @@ int main(int argc, char *argv[]) {
 		arg[i].type = i % 2; // 0 = Pub, 1 = Sub
 
 
-		arg[i].writer = writer;
-		arg[i].reader = reader;
+		arg[i].dds = &dds;
+		arg[i].publisher = &publisher;
+		arg[i].response = JobResponse();
 
 //viene assegnata la priorita ai thread come nell'rm
 		arg[i].priority = 99 - (arg[i].period_ms / 10);
@@ -171,9 +164,12 @@ int main(int argc, char *argv[]) {
 		std::cout << "[" << type_name << "] -> Violazioni Jitter (>0.1ms): "
 				<< std::setw(2) << arg[i].final_jitter_violations
 				<< " | Deadline Missed: " << std::setw(2)
-				<< arg[i].final_deadline_misses << "\n";
+				<< arg[i].final_deadline_misses << " | Risposta media: " << std::fixed
+				<< std::setprecision(3) << arg[i].response.avg_ms() << " ms max: "
+				<< arg[i].response.max_ms << " ms\n";
 	}
 	std::cout << "====================================================\n\n";
+	publisher.finish("PUB");
 
 	free(arg);
 	free(thread);
@@ -191,9 +187,12 @@ void* Task(void *ptr) {
 
 	// Aggiunto il tracciamento del Jitter massimo
 	double max_jitter = 0.0;
+	// percentili di cycle time (fra due attivazioni), jitter e risposta: su tutto il test e a finestre di 5 s
+	RollingLatency cycle_stats, jitter_stats, response_stats;
+	struct timespec last_start;
+	long window_iterations = 5000 / arg->period_ms;
 
-	SystemStats stats;
-	SampleInfo info;
+	SystemStatsPlain sample{};
 	float simulated_altitude = 15000.0f;
 
 	bool descending = true;
@@ -213,11 +212,14 @@ void* Task(void *ptr) {
 		double jitter = std::abs(time_diff_ms(next_activation, start_work));
 		if (jitter > max_jitter) max_jitter = jitter;
 		if (jitter > 0.1) CountViolation++;
+		jitter_stats.record((uint64_t) (jitter * 1e6));
+		if (i > 0) cycle_stats.record((uint64_t) (time_diff_ms(last_start, start_work) * 1e6));
+		last_start = start_work;
 
 		if (arg->type == TYPE_PUBLISHER) {
 			// Il Publisher crea i dati e li spedisce
-			stats.altitude(simulated_altitude);
-			arg->writer->write(&stats);
+			sample.altitude(simulated_altitude);
+			arg->publisher->publish(sample);
 			status = "[Dati Inviati]";
 			burn_cpu(2);
 
@@ -235,14 +237,8 @@ void* Task(void *ptr) {
 		}
 
 		else if (arg->type == TYPE_SUBSCRIBER) {
-			bool got_new_data = false;
-
-			while (arg->reader->take_next_sample((void*) &stats, &info) == RETCODE_OK) {
-				if (info.valid_data) {
-					simulated_altitude = stats.altitude();
-					got_new_data = true;
-				}
-			}
+			// tutto quello che è arrivato dall'ultima attivazione, conta l'ultima quota
+			bool got_new_data = arg->dds->take_latest_altitude(simulated_altitude);
 
 			if (got_new_data) {
 				if (simulated_altitude < 2500.0f) {
@@ -263,6 +259,8 @@ void* Task(void *ptr) {
 
 		clock_gettime(CLOCK_MONOTONIC, &end_work);
 		double response_time = time_diff_ms(start_work, end_work);
+		arg->response.record(response_time);
+		response_stats.record((uint64_t) (response_time * 1e6));
 
 		std::cout << "[" << type << "] Alt:" << std::setw(5)
 				<< (int) simulated_altitude << " | " << std::left
@@ -276,6 +274,16 @@ void* Task(void *ptr) {
 			std::cout << " | \033[1;31mDeadLineMISSED\033[0m\n";
 			CountDeadLineMiss++;
 		}
+
+		if (window_iterations > 0 && (i + 1) % window_iterations == 0) {
+			std::string prefix = "[" + type + "] ";
+			print_latency_row((prefix + "cycle 5s").c_str(), cycle_stats.window, 1e6, "ms");
+			print_latency_row((prefix + "jitter 5s").c_str(), jitter_stats.window, 1e6, "ms");
+			print_latency_row((prefix + "risposta 5s").c_str(), response_stats.window, 1e6, "ms");
+			cycle_stats.roll();
+			jitter_stats.roll();
+			response_stats.roll();
+		}
 	}
 
 	// Salvataggio statistiche e uscita
@@ -285,6 +293,10 @@ void* Task(void *ptr) {
 	std::cout << "\n====================================================";
 	std::cout << "\n[" << type << "] FINE THREAD -> PICCO MAX JITTER: "
 			  << std::fixed << std::setprecision(3) << max_jitter << " ms\n";
+	std::string prefix = "[" + type + "] ";
+	print_latency_row((prefix + "cycle").c_str(), cycle_stats.run, 1e6, "ms");
+	print_latency_row((prefix + "jitter").c_str(), jitter_stats.run, 1e6, "ms");
+	print_latency_row((prefix + "risposta").c_str(), response_stats.run, 1e6, "ms");
 	std::cout << "====================================================\n\n";
 
 	pthread_exit(NULL);
@@ -0,0 +1,126 @@
+//costo della dashboard di MonitorApp nel terminale con 20, 200 e 2000 campioni/s, tre modi di disegnare:
+//  full   tutto lo schermo a ogni campione (come la stampa di prima, ma in una write sola)
+//  diff   solo le celle cambiate, a ogni campione
+//  cap    solo le celle cambiate, al massimo 20 frame/s (quello che fa MonitorApp)
+//Per ogni modo: frame, byte al secondo verso il terminale e CPU al secondo (formattazione + write).
+//Il tempo dei campioni è simulato, il test non aspetta: per default si scrive su /dev/null, con tty sul terminale
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include "DashboardView.hpp"
+
+constexpr long CAP_FRAME_NS = 1000000000L / 20;
+
+// tempo di CPU del thread chiamante in nanosecondi
+long thread_cpu_ns() {
+	struct timespec t;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+	return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+enum class RenderMode { FULL, DIFF, CAP };
+
+struct RunResult {
+	long frames = 0;
+	double bytes_per_s = 0;
+	double cpu_ms_per_s = 0; // ms di CPU per secondo di telemetria
+};
+
+// seconds secondi di telemetria a rate campioni/s: traiettoria lenta come un volo vero, periodo con un po' di jitter
+RunResult run(RenderMode mode, int rate, int seconds, int fd) {
+	RunResult r;
+	TerminalGrid grid(DASHBOARD_COLS, DASHBOARD_ROWS);
+	RollingLatency cycle, jitter, response;
+	DashboardFrame frame;
+	frame.cycle = &cycle;
+	frame.jitter = &jitter;
+	frame.response = &response;
+
+	long period_ns = 1000000000L / rate;
+	long samples = (long) rate * seconds;
+	long last_frame_ns = -CAP_FRAME_NS;
+	long cpu_start = thread_cpu_ns();
+	for (long i = 0; i < samples; i++) {
+		long t_ns = i * period_ns;
+		double t = t_ns / 1e9;
+		long cycle_ns = period_ns + (long) (200000.0 * std::sin(i * 0.7));
+		cycle.record((uint64_t) cycle_ns);
+		jitter.record((uint64_t) std::labs(cycle_ns - period_ns));
+		response.record(20000 + (uint64_t) (i % 7) * 1000);
+		if (i % ((long) rate * 10) == 0) {
+			cycle.roll();
+			jitter.roll();
+			response.roll();
+		}
+
+		frame.telemetry.packet_id((uint32_t) i);
+		frame.telemetry.altitude(5000.0f + 3000.0f * (float) std::sin(t * 0.05));
+		frame.telemetry.speed(250.0f + 10.0f * (float) std::sin(t * 0.2));
+		frame.telemetry.roll(0.4f * (float) std::sin(t * 0.5));
+		frame.telemetry.pitch(0.1f * (float) std::sin(t * 0.3));
+		frame.telemetry.yaw(0.2f * (float) std::cos(t * 0.1));
+		frame.telemetry.latency_us((uint16_t) (20 + i % 7));
+		frame.cycle_time = cycle_ns / 1e6f;
+		frame.avg_jitter = (float) (jitter.recent().mean_ns() / 1e6);
+		frame.total_packets = i + 1;
+
+		if (mode == RenderMode::CAP) {
+			if (t_ns - last_frame_ns < CAP_FRAME_NS) continue;
+			last_frame_ns = t_ns;
+		}
+		if (mode == RenderMode::FULL) grid.invalidate();
+		draw_dashboard(grid, frame);
+		grid.flush(fd);
+	}
+	long cpu_ns = thread_cpu_ns() - cpu_start;
+
+	r.frames = grid.frames;
+	r.bytes_per_s = (double) grid.bytes_written / seconds;
+	r.cpu_ms_per_s = cpu_ns / 1e6 / seconds;
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./DashboardRenderBench [secondi] [tty]
+	int seconds = (argc > 1) ? std::stoi(argv[1]) : 10;
+	bool tty = argc > 2 && std::string(argv[2]) == "tty";
+	int fd = tty ? STDOUT_FILENO : open("/dev/null", O_WRONLY);
+	if (fd < 0) {
+		std::cerr << "Errore apertura /dev/null\n";
+		return 1;
+	}
+
+	struct Row {
+		int rate;
+		const char* mode;
+		RunResult r;
+	};
+	Row rows[9];
+	int n = 0;
+	for (int rate : { 20, 200, 2000 }) {
+		rows[n++] = { rate, "full", run(RenderMode::FULL, rate, seconds, fd) };
+		rows[n++] = { rate, "diff", run(RenderMode::DIFF, rate, seconds, fd) };
+		rows[n++] = { rate, "cap", run(RenderMode::CAP, rate, seconds, fd) };
+	}
+	if (tty) std::cout << "\033[2J\033[1;1H";
+
+	std::cout << "--- Dashboard nel terminale: " << seconds << " s di telemetria simulata, griglia "
+			<< DASHBOARD_COLS << "x" << DASHBOARD_ROWS << (tty ? " sul terminale" : " su /dev/null") << " ---\n";
+	std::cout << std::setw(10) << "campioni/s" << std::setw(8) << "modo" << std::setw(10) << "frame"
+			<< std::setw(14) << "kB/s" << std::setw(16) << "CPU ms/s" << std::setw(14) << "B/frame" << "\n";
+	for (int i = 0; i < n; i++) {
+		const RunResult &r = rows[i].r;
+		std::cout << std::setw(10) << rows[i].rate << std::setw(8) << rows[i].mode << std::setw(10) << r.frames
+				<< std::fixed << std::setprecision(1) << std::setw(14) << r.bytes_per_s / 1024.0
+				<< std::setprecision(2) << std::setw(16) << r.cpu_ms_per_s
+				<< std::setprecision(0) << std::setw(14) << (r.frames > 0 ? r.bytes_per_s * seconds / r.frames : 0.0) << "\n";
+	}
+	std::cout << "(CPU ms/s: millisecondi di CPU per ogni secondo di telemetria, 1000 = un core intero)\n";
+	if (!tty) close(fd);
+	return 0;
+}
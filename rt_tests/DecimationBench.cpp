@@ -0,0 +1,222 @@
+//costo lato writer della telemetria v2 con 1, 4 e 16 monitor collegati, tutti i campioni contro monitor
+//decimati con il filtro FBW_MIN_SEPARATION (MonitorApp [versione] [max_hz]): CPU del thread che pubblica,
+//CPU del processo e traffico sull'interfaccia lo. I participant usano solo UDPv4 così i contatori di
+///proc/net/dev vedono tutto quello che parte (con la memoria condivisa il traffico non passerebbe dalla rete)
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <time.h>
+#include <sys/resource.h>
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryDecimation.hpp"
+#include "TelemetryVersion.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+// byte e pacchetti trasmessi da lo, dalla riga "lo:" di /proc/net/dev (il nome è allineato a destra con spazi,
+// e va confrontato per intero: wlo1 contiene "lo")
+bool lo_counters(long &bytes, long &packets) {
+	std::ifstream f("/proc/net/dev");
+	std::string line;
+	while (std::getline(f, line)) {
+		size_t colon = line.find(':');
+		if (colon == std::string::npos) continue;
+		size_t start = line.find_first_not_of(" \t");
+		if (start >= colon || line.compare(start, colon - start, "lo") != 0) continue;
+		std::istringstream in(line.substr(colon + 1));
+		long v[10];
+		for (long &x : v) in >> x;
+		bytes = v[8];   // trasmessi: byte
+		packets = v[9]; // trasmessi: pacchetti
+		return true;
+	}
+	return false;
+}
+
+class CountingListener : public DataReaderListener {
+public:
+	std::atomic<long> received{0};
+
+	void on_data_available(DataReader *reader) override {
+		SystemStatsV2 sample;
+		SampleInfo info;
+		while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {
+			if (info.valid_data) received.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+};
+
+DomainParticipant *create_udp_participant(const std::string &name) {
+	DomainParticipantQos pqos;
+	pqos.name(name);
+	pqos.transport().use_builtin_transports = false;
+	pqos.transport().user_transports.push_back(std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>());
+	DomainParticipant *p = DomainParticipantFactory::get_instance()->create_participant(1, pqos);
+	if (p != nullptr) register_decimation_filter(p); // anche il writer: è lui che filtra per ogni monitor
+	return p;
+}
+
+Topic *create_v2_topic(DomainParticipant *p) {
+	TypeSupport type(new SystemStatsV2PubSubType());
+	type.register_type(p);
+	return p->create_topic(TELEMETRY_V2_TOPIC, type.get_type_name(), TOPIC_QOS_DEFAULT);
+}
+
+struct RunResult {
+	bool ok = false; // false: un participant, topic o endpoint non si è creato e i numeri non valgono
+	long sent = 0;
+	double received_per_monitor = 0; // campioni al secondo, media dei monitor
+	double cpu_writer_us = 0;        // per campione scritto, solo il thread che pubblica
+	double cpu_process_pct = 0;      // tutto il processo (monitor compresi) in percentuale di un core
+	double lo_packets_s = 0;
+	double lo_kbytes_s = 0;
+};
+
+RunResult run(int monitors, double max_rate_hz, int rate_hz, int seconds) {
+	RunResult r;
+	std::vector<DomainParticipant*> participants; // il primo è il writer, poi un participant per monitor
+	auto cleanup = [&participants]() {
+		for (DomainParticipant *p : participants) {
+			p->delete_contained_entities();
+			DomainParticipantFactory::get_instance()->delete_participant(p);
+		}
+	};
+	auto fail = [&](const std::string &what) {
+		std::cerr << "Errore DDS: " << what << "\n";
+		cleanup();
+		return r;
+	};
+
+	DomainParticipant *pub_participant = create_udp_participant("DecimationBench_Pub");
+	if (pub_participant == nullptr) return fail("participant del writer");
+	participants.push_back(pub_participant);
+	Topic *pub_topic = create_v2_topic(pub_participant);
+	if (pub_topic == nullptr) return fail("topic del writer");
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	DataWriter *writer = pub_participant->create_publisher(PUBLISHER_QOS_DEFAULT)->create_datawriter(pub_topic, wqos);
+	if (writer == nullptr) return fail("writer");
+
+	// un participant per monitor, come tanti MonitorApp: se ne manca uno il conteggio dei monitor è sbagliato
+	std::vector<std::unique_ptr<CountingListener>> listeners;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	for (int m = 0; m < monitors; m++) {
+		std::string name = "DecimationBench_Monitor" + std::to_string(m);
+		DomainParticipant *p = create_udp_participant(name);
+		if (p == nullptr) return fail("participant di " + name);
+		participants.push_back(p);
+		Topic *topic = create_v2_topic(p);
+		if (topic == nullptr) return fail("topic di " + name);
+		listeners.emplace_back(new CountingListener());
+		TopicDescription *description = topic;
+		if (max_rate_hz > 0.0) {
+			description = create_decimated_topic(p, topic, max_rate_hz);
+			if (description == nullptr) return fail("topic decimato di " + name);
+		}
+		if (p->create_subscriber(SUBSCRIBER_QOS_DEFAULT)->create_datareader(description, rqos, listeners.back().get()) == nullptr) {
+			return fail("reader di " + name);
+		}
+	}
+
+	// aspetto che tutti i monitor siano scoperti
+	PublicationMatchedStatus matched;
+	for (int waited = 0; waited < 5000; waited += 10) {
+		writer->get_publication_matched_status(matched);
+		if (matched.current_count >= monitors) break;
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+	long bytes_start = 0, packets_start = 0, bytes_end = 0, packets_end = 0;
+	lo_counters(bytes_start, packets_start);
+	long process_cpu_start = cpu_us(RUSAGE_SELF);
+	long writer_cpu_start = cpu_us(RUSAGE_THREAD);
+
+	SystemStatsV2 sample;
+	sample.speed(100.0f);
+	long period_us = 1000000L / rate_hz;
+	long samples = (long) rate_hz * seconds;
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_ns(&next, period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		sample.packet_id((uint32_t) i);
+		sample.altitude(5000.0f + (i % 1000));
+		writer->write(&sample);
+		r.sent++;
+	}
+	long writer_cpu = cpu_us(RUSAGE_THREAD) - writer_cpu_start;
+	std::this_thread::sleep_for(std::chrono::milliseconds(200)); // ultimi ACKNACK e GAP
+	long process_cpu = cpu_us(RUSAGE_SELF) - process_cpu_start;
+	lo_counters(bytes_end, packets_end);
+
+	double elapsed_s = seconds + 0.2;
+	long received = 0;
+	for (auto &l : listeners) received += l->received.load();
+	if (!listeners.empty()) r.received_per_monitor = (double) received / listeners.size() / seconds;
+	r.cpu_writer_us = (double) writer_cpu / std::max(r.sent, 1L);
+	r.cpu_process_pct = process_cpu / (elapsed_s * 1e6) * 100.0;
+	r.lo_packets_s = (packets_end - packets_start) / elapsed_s;
+	r.lo_kbytes_s = (bytes_end - bytes_start) / elapsed_s / 1024.0;
+
+	cleanup();
+	r.ok = true;
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./DecimationBench [secondi] [frequenza_hz] [max_hz]
+	int seconds = (argc > 1) ? std::stoi(argv[1]) : 5;
+	int rate_hz = (argc > 2) ? std::stoi(argv[2]) : 500;
+	double max_rate_hz = (argc > 3) ? std::stod(argv[3]) : 20.0;
+
+	// monitor e writer nello stesso processo devono comunque passare da UDP
+	eprosima::fastdds::LibrarySettings settings;
+	settings.intraprocess_delivery = eprosima::fastdds::INTRAPROCESS_OFF;
+	DomainParticipantFactory::get_instance()->set_library_settings(settings);
+
+	std::cout << "--- Telemetria v2 a " << rate_hz << " Hz per " << seconds << " s, monitor decimati a "
+			<< max_rate_hz << " Hz (UDPv4, dominio 1) ---\n";
+	std::cout << std::setw(8) << "monitor" << std::setw(12) << "modo" << std::setw(14) << "rx/monitor"
+			<< std::setw(14) << "CPU writer" << std::setw(12) << "CPU proc" << std::setw(12) << "lo pkt/s"
+			<< std::setw(12) << "lo KB/s" << "\n";
+	for (int monitors : { 1, 4, 16 }) {
+		for (double max_hz : { 0.0, max_rate_hz }) {
+			RunResult r = run(monitors, max_hz, rate_hz, seconds);
+			if (!r.ok) return 1;
+			std::cout << std::setw(8) << monitors << std::setw(12) << (max_hz > 0.0 ? "decimati" : "tutti")
+					<< std::fixed << std::setprecision(1)
+					<< std::setw(10) << r.received_per_monitor << " c/s"
+					<< std::setw(9) << r.cpu_writer_us << " us/c"
+					<< std::setw(10) << r.cpu_process_pct << " %"
+					<< std::setw(12) << r.lo_packets_s << std::setw(12) << r.lo_kbytes_s << "\n";
+		}
+	}
+	std::cout << "(CPU writer: thread che chiama write(), per campione; CPU proc: tutto il processo, monitor compresi)\n";
+	return 0;
+}
@@ -0,0 +1,89 @@
+//passi aereo al secondo della flotta SoA: fbw_step un aereo alla volta contro il kernel SIMD,
+//con 1, 8, 64 e 4096 aerei e lo scostamento fra i due dopo 10 s simulati (sin/cos polinomiali)
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <time.h>
+#include "FleetPhysics.hpp"
+
+double time_diff_s(struct timespec start, struct timespec end) {
+	return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+// flotta con lo stesso seme per i due motori, una parte parte già dentro l'inviluppo di recovery
+void init_fleet(FleetState& f) {
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> altitude(1500.0f, 14000.0f);
+	std::uniform_real_distribution<float> speed(0.0f, 200.0f);
+	std::uniform_real_distribution<float> roll(-1.5f, 1.5f);
+	std::uniform_real_distribution<float> pitch(-0.5f, 0.5f);
+	std::uniform_real_distribution<float> yaw(-3.14159f, 3.14159f);
+	for (size_t i = 0; i < f.size(); i++) {
+		PlaneData p{};
+		p.altitude = altitude(rng);
+		p.speed = speed(rng);
+		p.roll = roll(rng);
+		p.pitch = pitch(rng);
+		p.yaw = yaw(rng);
+		f.set(i, p);
+	}
+}
+
+template <typename Step>
+double bench(size_t n, long steps, float dt_scale, Step step) {
+	FleetState f(n);
+	init_fleet(f);
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (long s = 0; s < steps; s++) step(f, dt_scale);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	volatile float sink = f.altitude[0]; // il compilatore non può saltare i passi
+	(void) sink;
+	return (double) n * steps / time_diff_s(start, end);
+}
+
+// massimo scostamento di quota fra i due motori dopo steps passi
+float divergence(size_t n, long steps, float dt_scale) {
+	FleetState a(n), b(n);
+	init_fleet(a);
+	init_fleet(b);
+	for (long s = 0; s < steps; s++) {
+		fleet_step_scalar(a, dt_scale);
+		fleet_step_simd(b, dt_scale);
+	}
+	float max_diff = 0.0f;
+	for (size_t i = 0; i < n; i++) max_diff = std::max(max_diff, std::abs(a.altitude[i] - b.altitude[i]));
+	return max_diff;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./FleetBench [passi_aereo_totali] [rate_hz]
+	double total = (argc > 1) ? std::stod(argv[1]) : 5e7;
+	int rate_hz = (argc > 2) ? std::stoi(argv[2]) : 60;
+	float dt_scale = step_scale((float) rate_hz);
+
+	size_t sizes[4] = { 1, 8, 64, 4096 };
+
+	std::cout << "--- Flotta SoA: ~" << total << " passi aereo per misura a " << rate_hz << " Hz, "
+			<< FLEET_LANES << " corsie SIMD ---\n";
+	std::cout << std::left << std::setw(8) << "aerei" << std::right
+			<< std::setw(16) << "scalare" << std::setw(16) << "SIMD" << std::setw(10) << "speedup"
+			<< std::setw(18) << "max dQuota 10s\n";
+
+	for (size_t n : sizes) {
+		long steps = std::max(1L, (long) (total / n));
+		double scalar = bench(n, steps, dt_scale, fleet_step_scalar);
+		double simd = bench(n, steps, dt_scale, fleet_step_simd);
+		float diff = divergence(n, 10 * rate_hz, dt_scale);
+
+		std::cout << std::left << std::setw(8) << n << std::right << std::fixed << std::setprecision(1)
+				<< std::setw(12) << scalar / 1e6 << " M/s" << std::setw(12) << simd / 1e6 << " M/s"
+				<< std::setw(9) << std::setprecision(2) << simd / scalar << "x"
+				<< std::setw(14) << std::setprecision(6) << diff << " m\n";
+	}
+	return 0;
+}
@@ -0,0 +1,163 @@
+//telemetria di flotta con chiave (AircraftTelemetry su TelemetryFleetTopic) con 10, 1000 e 10000 aerei:
+//a ogni giro il writer pubblica un campione per aereo, ognuno sulla sua istanza registrata una volta sola.
+//Il reader tiene l'ultimo campione di ogni istanza (KEEP_LAST 1) e a ogni giro fa una passata di read() e una di
+//take() a gruppi con prestito, la take aggiorna anche lo stato per aereo in una FlatHashMap come la dashboard.
+//Per ogni numero di istanze: campioni/s di read e di take, memoria del processo per istanza e byte della tabella.
+//Publisher e subscriber sono due participant dello stesso processo con la consegna intraprocesso spenta
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <fstream>
+#include <unistd.h>
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "FlatHashMap.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+constexpr int32_t TAKE_BATCH = 256; // campioni per chiamata di read/take
+
+// memoria residente del processo in kB (seconda colonna di /proc/self/statm, in pagine)
+long rss_kb() {
+	long pages_total = 0, pages_resident = 0;
+	std::ifstream statm("/proc/self/statm");
+	statm >> pages_total >> pages_resident;
+	return pages_resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+// quello che la dashboard tiene per ogni aereo
+struct AircraftSlot {
+	uint32_t last_packet = 0;
+	long received = 0;
+};
+
+// un campione per istanza sia nel writer sia nel reader, con posto per tutte le istanze
+// (il default di Fast DDS è 10 istanze)
+Endpoints create_fleet_endpoints(int instances) {
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+	rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+	wqos.history().depth = 1;
+	rqos.history().depth = 1;
+	for (ResourceLimitsQosPolicy *limits : { &wqos.resource_limits(), &rqos.resource_limits() }) {
+		limits->max_instances = instances;
+		limits->max_samples_per_instance = 1;
+		limits->max_samples = instances;
+		limits->allocated_samples = instances;
+	}
+	return create_endpoints("FleetBench", transport_profile_from_env(), [] { return new AircraftTelemetryPubSubType(); },
+			"TelemetryFleetTopic", wqos, rqos);
+}
+
+// aspetta che il reader abbia un campione non letto per ogni aereo, false dopo 5 s
+bool wait_all_unread(DataReader *reader, int instances) {
+	for (int waited = 0; waited < 5000; waited++) {
+		if ((int) reader->get_unread_count() >= instances) return true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return false;
+}
+
+struct RunResult {
+	long rounds = 0;
+	double read_per_s = 0;   // campioni/s con read(), solo quelli non ancora letti
+	double take_per_s = 0;   // campioni/s con take() + aggiornamento della tabella
+	double take_ns = 0;      // costo medio per campione della take
+	double rss_per_instance = 0; // byte per istanza di tutto il processo (writer, reader e tabella)
+	size_t map_bytes = 0;
+	long incomplete = 0;     // giri in cui non sono arrivati tutti gli aerei entro il timeout
+};
+
+RunResult run(int instances, int rounds) {
+	RunResult r;
+	long rss_start = rss_kb();
+	Endpoints e = create_fleet_endpoints(instances);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	// un'istanza per aereo, la chiave si calcola qui e non a ogni write
+	AircraftTelemetry sample;
+	sample.speed(100.0f);
+	std::vector<eprosima::fastdds::rtps::InstanceHandle_t> handles(instances);
+	for (int id = 0; id < instances; id++) {
+		sample.aircraft_id((uint32_t) id);
+		handles[id] = e.writer->register_instance(&sample);
+	}
+	FlatHashMap<AircraftSlot> fleet(instances);
+
+	LoanableSequence<AircraftTelemetry> data;
+	SampleInfoSeq infos;
+	long read_total = 0, take_total = 0;
+	long read_ns = 0, take_ns = 0;
+	for (int round = 0; round < rounds; round++) {
+		for (int id = 0; id < instances; id++) {
+			sample.aircraft_id((uint32_t) id);
+			sample.packet_id((uint32_t) round);
+			sample.altitude(5000.0f + id);
+			e.writer->write(&sample, handles[id]);
+		}
+		if (!wait_all_unread(e.reader, instances)) r.incomplete++;
+
+		// read: una passata su tutte le istanze, i campioni restano nel reader
+		long start = now_ns();
+		while (e.reader->read(data, infos, TAKE_BATCH, NOT_READ_SAMPLE_STATE, ANY_VIEW_STATE, ANY_INSTANCE_STATE) == RETCODE_OK) {
+			read_total += data.length();
+			e.reader->return_loan(data, infos);
+		}
+		read_ns += now_ns() - start;
+
+		// take: stessi campioni, questa volta tolti dal reader e passati alla tabella della flotta
+		start = now_ns();
+		while (e.reader->take(data, infos, TAKE_BATCH) == RETCODE_OK) {
+			for (int32_t i = 0; i < data.length(); i++) {
+				if (!infos[i].valid_data) continue;
+				AircraftSlot &slot = fleet[data[i].aircraft_id()];
+				slot.last_packet = data[i].packet_id();
+				slot.received++;
+			}
+			take_total += data.length();
+			e.reader->return_loan(data, infos);
+		}
+		take_ns += now_ns() - start;
+		if (round == 0) r.rss_per_instance = (rss_kb() - rss_start) * 1024.0 / instances;
+	}
+
+	r.rounds = rounds;
+	r.read_per_s = read_ns > 0 ? read_total * 1e9 / read_ns : 0;
+	r.take_per_s = take_ns > 0 ? take_total * 1e9 / take_ns : 0;
+	r.take_ns = take_total > 0 ? (double) take_ns / take_total : 0;
+	r.map_bytes = fleet.memory_bytes();
+	delete_endpoints(e);
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./FleetTelemetryBench [giri]
+	int rounds = (argc > 1) ? std::stoi(argv[1]) : 20;
+
+	bench_library_settings();
+
+	std::cout << "--- Telemetria di flotta con chiave: " << rounds << " giri, un campione per aereo a giro (dominio 1) ---\n";
+	std::cout << std::setw(8) << "aerei" << std::setw(16) << "read/s" << std::setw(16) << "take/s"
+			<< std::setw(14) << "take/camp." << std::setw(16) << "RSS/istanza" << std::setw(14) << "tabella"
+			<< std::setw(12) << "incompleti" << "\n";
+	for (int instances : { 10, 1000, 10000 }) {
+		RunResult r = run(instances, rounds);
+		std::cout << std::setw(8) << instances << std::fixed << std::setprecision(0)
+				<< std::setw(16) << r.read_per_s << std::setw(16) << r.take_per_s
+				<< std::setprecision(1) << std::setw(11) << r.take_ns << " ns"
+				<< std::setprecision(0) << std::setw(13) << r.rss_per_instance << " B"
+				<< std::setprecision(1) << std::setw(11) << r.map_bytes / 1024.0 << " kB" << std::setw(12) << r.incomplete << "\n";
+	}
+	std::cout << "(read e take a gruppi di " << TAKE_BATCH << " con prestito; RSS/istanza: crescita del processo dopo il primo giro)\n";
+	return 0;
+}
@@ -0,0 +1,199 @@
+//scenario di inversione di priorità sul SharedMemoryBus: tre thread SCHED_FIFO sullo stesso core
+// LOW  (writer)  scrive sul bus e resta nella sezione critica per cs_ms (sensore lento)
+// MED  (hog)     non usa il bus, consuma cpu per hog_ms con burn_cpu
+// HIGH (reader)  legge dal bus e misura quanto resta bloccato sul mutex
+//con PRIO_NONE il MED può fermare il LOW mentre ha il lock, quindi anche il HIGH aspetta fino a hog_ms;
+//con PRIO_INHERIT / PRIO_PROTECT il blocco del HIGH resta limitato a circa cs_ms
+#include <iostream>
+#include <vector>
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <time.h>
+#include <cstring>
+#include <cmath>
+#include <iomanip>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "SharedMemory.hpp"
+
+#define handle_error(en, msg) \
+        if(en != 0) {errno = en; perror(msg); exit(EXIT_FAILURE);}
+
+#define TYPE_WRITER_LOW  0
+#define TYPE_HOG_MEDIUM  1
+#define TYPE_READER_HIGH 2
+
+typedef struct arg {
+	int id;
+	long period_ms;
+	long work_ms;
+	int priority;
+	int type;
+	int iterations;
+
+	SharedMemoryBus *bus;
+
+	// risultati del reader
+	double max_block_ms;
+	double sum_block_ms;
+	int samples;
+	int long_blocks; // blocchi più lunghi della sezione critica del writer
+	double max_jitter_ms; // con PRIO_PROTECT il ritardo si sposta sull'attivazione del reader
+} t_arg;
+
+void* Task(void *ptr);
+
+void timespec_add_ms(struct timespec *t, long ms) {
+	t->tv_sec += ms / 1000;
+	t->tv_nsec += (ms % 1000) * 1000000;
+	if (t->tv_nsec >= 1000000000) {
+		t->tv_sec++;
+		t->tv_nsec -= 1000000000;
+	}
+}
+
+double time_diff_ms(struct timespec start, struct timespec end) {
+	double s = end.tv_sec - start.tv_sec;
+	double ns = end.tv_nsec - start.tv_nsec;
+	return (s * 1000.0) + (ns / 1000000.0);
+}
+
+void burn_cpu(long ms) {
+	struct timespec start, current;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	do {
+		clock_gettime(CLOCK_MONOTONIC, &current);
+	} while (time_diff_ms(start, current) < ms);
+}
+
+t_arg run_scenario(BusLockPolicy policy, int durata_s, long cs_ms, long hog_ms) {
+
+	SharedMemoryBus bus(policy, 90); // ceiling = priorità del reader
+
+	int NUM_THREADS = 3;
+	int TARGET_CORE = 0; // tutti sullo stesso core altrimenti l'inversione non si vede
+	pthread_attr_t attributes;
+	pthread_attr_init(&attributes);
+	pthread_attr_setdetachstate(&attributes, PTHREAD_CREATE_JOINABLE);
+	pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED);
+
+	if (pthread_attr_setschedpolicy(&attributes, SCHED_FIFO) != 0) {
+		std::cerr << "ERROR: Cannot set SCHED_FIFO. Run with sudo.\n";
+		exit(1);
+	}
+
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(TARGET_CORE, &cpuset);
+	pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set_t), &cpuset);
+
+	t_arg arg[3];
+	pthread_t thread[3];
+	struct sched_param param;
+
+	long period[3] = { 7, 20, 5 };
+	long work[3] = { cs_ms, hog_ms, cs_ms }; // per il reader è la soglia dei blocchi lunghi
+	int priority[3] = { 10, 50, 90 };
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		memset(&arg[i], 0, sizeof(t_arg));
+		arg[i].id = i + 1;
+		arg[i].type = i;
+		arg[i].period_ms = period[i];
+		arg[i].work_ms = work[i];
+		arg[i].priority = priority[i];
+		arg[i].iterations = (durata_s * 1000) / period[i];
+		arg[i].bus = &bus;
+
+		param.sched_priority = arg[i].priority;
+		pthread_attr_setschedparam(&attributes, &param);
+
+		int ret = pthread_create(&(thread[i]), &attributes, Task, (void*) &(arg[i]));
+		handle_error(ret, "Thread Creation Failed");
+	}
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		pthread_join(thread[i], NULL);
+	}
+	pthread_attr_destroy(&attributes);
+
+	return arg[TYPE_READER_HIGH];
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: sudo ./PriorityInversion [durata_s] [cs_ms] [hog_ms]
+	int durata_s = (argc > 1) ? std::stoi(argv[1]) : 5;
+	long cs_ms = (argc > 2) ? std::stol(argv[2]) : 2;
+	long hog_ms = (argc > 3) ? std::stol(argv[3]) : 10;
+
+	mlockall(MCL_CURRENT | MCL_FUTURE);
+
+	BusLockPolicy policies[3] = { BusLockPolicy::DEFAULT, BusLockPolicy::INHERIT, BusLockPolicy::PROTECT };
+	t_arg results[3];
+
+	for (int p = 0; p < 3; p++) {
+		std::cout << "--- Scenario " << lock_policy_name(policies[p]) << " (" << durata_s << " s, sezione critica "
+				<< cs_ms << " ms, hog " << hog_ms << " ms) ---\n";
+		results[p] = run_scenario(policies[p], durata_s, cs_ms, hog_ms);
+	}
+
+	std::cout << "\n====================================================\n";
+	std::cout << "      BLOCCO DEL READER AD ALTA PRIORITA' SUL BUS     \n";
+	std::cout << "====================================================\n";
+	for (int p = 0; p < 3; p++) {
+		double avg = results[p].samples > 0 ? results[p].sum_block_ms / results[p].samples : 0.0;
+		std::cout << std::left << std::setw(13) << lock_policy_name(policies[p]) << std::right << std::fixed
+				<< std::setprecision(3) << " -> Max: " << std::setw(7) << results[p].max_block_ms << " ms"
+				<< " | Medio: " << std::setw(6) << avg << " ms"
+				<< " | Blocchi > CS: " << std::setw(4) << results[p].long_blocks << "/" << results[p].samples
+				<< " | Jitter max: " << std::setw(7) << results[p].max_jitter_ms << " ms\n";
+	}
+	std::cout << "====================================================\n\n";
+	return 0;
+}
+
+void* Task(void *ptr) {
+	t_arg *arg = (t_arg*) ptr;
+
+	struct timespec next_activation, start_block, end_block;
+	FlightControls controls;
+
+	clock_gettime(CLOCK_MONOTONIC, &next_activation);
+
+	for (int i = 0; i < arg->iterations; i++) {
+		timespec_add_ms(&next_activation, arg->period_ms);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_activation, NULL);
+
+		if (arg->type == TYPE_WRITER_LOW) {
+			// la lettura del sensore avviene con il lock preso
+			arg->bus->update([&](FlightControls& d) {
+				burn_cpu(arg->work_ms);
+				d.packet_id = i;
+				d.altitude = 4000.0f;
+			});
+		}
+
+		else if (arg->type == TYPE_HOG_MEDIUM) {
+			burn_cpu(arg->work_ms);
+		}
+
+		else if (arg->type == TYPE_READER_HIGH) {
+			// timeout 0: il tempo misurato è solo l'attesa del mutex
+			clock_gettime(CLOCK_MONOTONIC, &start_block);
+			double jitter = std::abs(time_diff_ms(next_activation, start_block));
+			if (jitter > arg->max_jitter_ms) arg->max_jitter_ms = jitter;
+			arg->bus->read_with_timeout(controls, 0);
+			clock_gettime(CLOCK_MONOTONIC, &end_block);
+
+			double blocked = time_diff_ms(start_block, end_block);
+			if (blocked > arg->max_block_ms) arg->max_block_ms = blocked;
+			arg->sum_block_ms += blocked;
+			arg->samples++;
+			if (blocked > arg->work_ms) arg->long_blocks++;
+		}
+	}
+
+	pthread_exit(NULL);
+}
@@ -0,0 +1,175 @@
+//tre modi di leggere la telemetria SystemStatsV2 dallo stesso writer:
+//  listener  on_data_available nel thread di Fast DDS, take_next_sample un campione alla volta (MonitorApp di default)
+//  polling   thread nostro che ogni poll_us svuota il reader con take_next_sample (come il Task dei test rt_tests)
+//  waitset   thread nostro che dorme sul WaitSet e prende con take() in prestito a gruppi di batch (WaitSetReader)
+//Per ogni modo: costo per campione della presa dal reader, latenza dalla write alla presa (p50, p99, p99.9, max)
+//e CPU di tutto il processo per campione. polling e waitset girano con la priorità SCHED_FIFO data (0 = normale),
+//il listener resta nel thread di Fast DDS. Publisher e subscriber sono due participant dello stesso processo con la
+//consegna intraprocesso spenta
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <string>
+#include <time.h>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "WaitSetReader.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+enum class ReaderMode { LISTENER, POLLING, WAITSET };
+
+// istante di presa di ogni packet_id e tempo passato dentro take/take_next_sample, lo scrive un thread solo
+struct Receiver {
+	std::vector<long> recv_ns;
+	std::atomic<long> received{0};
+	long dequeue_ns = 0;
+
+	void mark(const SystemStatsV2 &sample, long t) {
+		received.fetch_add(mark_arrival(recv_ns, sample.packet_id(), t), std::memory_order_relaxed);
+	}
+
+	// take_next_sample finché il reader non è vuoto
+	void drain_one_by_one(DataReader *reader) {
+		SystemStatsV2 sample;
+		SampleInfo info;
+		long start = now_ns();
+		while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {
+			if (info.valid_data) mark(sample, start);
+		}
+		dequeue_ns += now_ns() - start;
+	}
+
+	void drain_batched(DataReader *reader, int32_t batch) {
+		long start = now_ns();
+		take_batch<SystemStatsV2>(reader, batch, [&](const SystemStatsV2 &sample, const SampleInfo &info, bool) {
+			if (info.valid_data) mark(sample, start);
+		});
+		dequeue_ns += now_ns() - start;
+	}
+};
+
+class BenchListener : public DataReaderListener {
+	Receiver &receiver;
+
+public:
+	explicit BenchListener(Receiver &r) : receiver(r) {}
+
+	void on_data_available(DataReader *reader) override { receiver.drain_one_by_one(reader); }
+};
+
+// con listener == nullptr il reader non chiama nessuno (polling e waitset)
+Endpoints create_reader_endpoints(DataReaderListener *listener) {
+	// storia abbastanza lunga che il polling non perda campioni fra due passate
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	wqos.history().kind = KEEP_LAST_HISTORY_QOS;
+	rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+	wqos.history().depth = 256;
+	rqos.history().depth = 256;
+	return create_endpoints("ReaderModeBench", transport_profile_from_env(), [] { return new SystemStatsV2PubSubType(); },
+			"TelemetryV2Topic", wqos, rqos, listener, listener != nullptr ? StatusMask::all() : StatusMask::none());
+}
+
+// polling: svuota il reader ogni poll_us, come il subscriber periodico dei test rt_tests
+void polling_task(DataReader *reader, Receiver *receiver, long poll_us, int priority, std::atomic<bool> *running) {
+	pin_current_thread(-1, priority);
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	while (running->load()) {
+		timespec_add_ns(&next, poll_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		receiver->drain_one_by_one(reader);
+	}
+}
+
+struct RunResult {
+	long received = 0;
+	double dequeue_ns = 0; // per campione
+	LatencyHistogram latency;
+	double process_cpu_us = 0; // per campione
+	long wakeups = 0;          // solo waitset
+};
+
+RunResult run(ReaderMode mode, long samples, long period_us, int32_t batch, long poll_us, int priority) {
+	RunResult r;
+	Receiver receiver;
+	receiver.recv_ns.assign(samples, 0);
+	BenchListener listener(receiver);
+	Endpoints e = create_reader_endpoints(mode == ReaderMode::LISTENER ? &listener : nullptr);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	std::atomic<bool> running{true};
+	std::thread poller;
+	WaitSetReader waitset;
+	if (mode == ReaderMode::POLLING) {
+		poller = std::thread(polling_task, e.reader, &receiver, poll_us, priority, &running);
+	} else if (mode == ReaderMode::WAITSET) {
+		waitset.attach(e.reader, [&](DataReader *reader) { receiver.drain_batched(reader, batch); });
+		waitset.start(-1, priority);
+	}
+
+	std::vector<long> send_ns(samples, 0);
+	SystemStatsV2 sample;
+	sample.speed(100.0f);
+	long cpu_start = cpu_us(RUSAGE_SELF);
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_ns(&next, period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		sample.packet_id((uint32_t) i);
+		sample.altitude(5000.0f + (i % 1000));
+		send_ns[i] = now_ns();
+		e.writer->write(&sample);
+	}
+	// gli ultimi campioni, al massimo 1 s
+	for (int waited = 0; waited < 1000 && receiver.received.load() < samples; waited++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	long cpu = cpu_us(RUSAGE_SELF) - cpu_start;
+
+	running = false;
+	if (poller.joinable()) poller.join();
+	waitset.shutdown();
+	r.wakeups = waitset.wakeup_count();
+	delete_endpoints(e);
+
+	r.latency = arrival_latency(send_ns, receiver.recv_ns);
+	r.received = (long) r.latency.total;
+	r.dequeue_ns = r.received > 0 ? (double) receiver.dequeue_ns / r.received : 0;
+	r.process_cpu_us = (double) cpu / samples;
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./ReaderModeBench [campioni] [periodo_us] [batch] [priorita] [poll_us]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 20000;
+	long period_us = (argc > 2) ? std::stol(argv[2]) : 500;
+	int32_t batch = (argc > 3) ? std::stoi(argv[3]) : READER_DEFAULT_BATCH;
+	int priority = (argc > 4) ? std::stoi(argv[4]) : 0;
+	long poll_us = (argc > 5) ? std::stol(argv[5]) : 1000;
+
+	bench_library_settings();
+
+	std::cout << "--- Lettura della telemetria: " << samples << " campioni ogni " << period_us << " us, batch " << batch
+			<< ", poll " << poll_us << " us, priorita' " << priority << " (dominio 1) ---\n";
+	const char *names[] = { "listener", "polling", "waitset" };
+	for (ReaderMode mode : { ReaderMode::LISTENER, ReaderMode::POLLING, ReaderMode::WAITSET }) {
+		RunResult r = run(mode, samples, period_us, batch, poll_us, priority);
+		print_latency_row(names[(int) mode], r.latency, 1000.0, "us");
+		std::printf("%-22s presa %.0f ns/camp., CPU %.2f us/camp.", "", r.dequeue_ns, r.process_cpu_us);
+		if (mode == ReaderMode::WAITSET) std::printf(", %ld sveglie", r.wakeups);
+		std::printf("\n");
+	}
+	std::cout << "(latenza: dalla write alla presa dal reader; CPU per campione di tutto il processo)\n";
+	return 0;
+}
@@ -0,0 +1,103 @@
+//costo delle statistiche Fast DDS sulla telemetria: stessi campioni SystemStats con i livelli off, basic e full
+//di StatisticsLevel.hpp. Per ogni livello: latenza dalla write alla take (p50-p99.9, max), CPU della write nel
+//thread che pubblica e CPU di tutto il processo per campione, con la differenza rispetto a off.
+//I livelli si cambiano a programma avviato sugli stessi participant, come si farebbe per una diagnosi temporanea.
+//Publisher e subscriber sono due participant dello stesso processo con la consegna intraprocesso spenta
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <time.h>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "StatisticsLevel.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+// tempo di CPU del thread chiamante in nanosecondi, abbastanza fine per una write sola
+long thread_cpu_ns() {
+	struct timespec t;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+	return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+struct RunResult {
+	LatencyHistogram latency;
+	double write_cpu_us = 0;   // thread che pubblica, per campione
+	double process_cpu_us = 0; // tutto il processo (thread di Fast DDS compresi), per campione
+};
+
+RunResult run(Endpoints &e, long samples, long period_us) {
+	RunResult r;
+	std::vector<long> send_ns(samples, 0), recv_ns(samples, 0);
+	SystemStats sample;
+	sample.speed(100.0f);
+	sample.status_msg("NOMINAL FLIGHT");
+
+	std::thread sub(subscriber_task<SystemStats>, e.reader, &recv_ns);
+	long process_start = cpu_us(RUSAGE_SELF);
+	long write_cpu = 0;
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_ns(&next, period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		sample.packet_id((uint32_t) i);
+		sample.altitude(5000.0f + (i % 1000));
+		long before = thread_cpu_ns();
+		send_ns[i] = now_ns();
+		e.writer->write(&sample);
+		write_cpu += thread_cpu_ns() - before;
+	}
+	sub.join();
+	long process_cpu = cpu_us(RUSAGE_SELF) - process_start;
+
+	r.latency = arrival_latency(send_ns, recv_ns);
+	r.write_cpu_us = write_cpu / 1000.0 / samples;
+	r.process_cpu_us = (double) process_cpu / samples;
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./StatisticsBench [campioni] [periodo_us]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 20000;
+	long period_us = (argc > 2) ? std::stol(argv[2]) : 500;
+
+	bench_library_settings();
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	Endpoints e = create_endpoints("StatisticsBench", transport_profile_from_env(), [] { return new SystemStatsPubSubType(); },
+			"TelemetryTopic", wqos, rqos);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return 1;
+	}
+
+	std::cout << "--- Statistiche Fast DDS: " << samples << " campioni ogni " << period_us << " us (dominio 1) ---\n";
+	StatisticsLevel current = StatisticsLevel::OFF;
+	RunResult off;
+	for (StatisticsLevel level : { StatisticsLevel::OFF, StatisticsLevel::BASIC, StatisticsLevel::FULL }) {
+		// tutti e due i lati: HISTORY_LATENCY la calcola il lettore, NETWORK_LATENCY chi riceve i pacchetti
+		bool available = set_statistics_level(e.pub_participant, current, level);
+		set_statistics_level(e.sub_participant, current, level);
+		current = level;
+		if (!available) {
+			std::cout << statistics_level_name(level) << ": Fast DDS senza FASTDDS_STATISTICS, salto\n";
+			continue;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(200)); // discovery dei DataWriter di statistiche
+
+		RunResult r = run(e, samples, period_us);
+		if (level == StatisticsLevel::OFF) off = r;
+		print_latency_row(statistics_level_name(level), r.latency, 1000.0, "us");
+		std::printf("%-22s CPU write %.2f us (%+.2f vs off), CPU proc %.2f us (%+.2f vs off)\n", "", r.write_cpu_us,
+				r.write_cpu_us - off.write_cpu_us, r.process_cpu_us, r.process_cpu_us - off.process_cpu_us);
+	}
+	std::cout << "(CPU per campione; write: solo il thread che pubblica, proc: tutto il processo)\n";
+
+	delete_endpoints(e);
+	return 0;
+}
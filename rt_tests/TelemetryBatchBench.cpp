@@ -0,0 +1,134 @@
+//telemetria v2 a pacchetti su TelemetryBatchTopic con batch da 1 a 256 campioni:
+//- tetto: il publisher scrive senza pause (RELIABLE, KEEP_ALL, la write si blocca quando il lettore è indietro),
+//  campioni al secondo arrivati al subscriber
+//- latenza: un campione ogni periodo_us, dal riempimento del campione allo spacchettamento nel subscriber,
+//  il batch parte quando è pieno o quando il primo campione ha aspettato la finestra
+//Publisher e subscriber sono due participant dello stesso processo con la consegna intraprocesso spenta
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <string>
+#include <time.h>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryBatch.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+Endpoints create_batch_endpoints() {
+	// nessun campione perso: quando la storia del writer è piena la write aspetta il lettore
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	wqos.reliability().max_blocking_time = Duration_t(1, 0);
+	wqos.history().kind = KEEP_ALL_HISTORY_QOS;
+	wqos.resource_limits().max_samples = 64;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.history().kind = KEEP_ALL_HISTORY_QOS;
+	rqos.resource_limits().max_samples = 256;
+	return create_endpoints("BatchBench", transport_profile_from_env(), [] { return new SystemStatsBatchPubSubType(); },
+			TELEMETRY_BATCH_TOPIC, wqos, rqos);
+}
+
+// Il subscriber spacchetta e segna l'istante di arrivo di ogni packet_id, si ferma dopo 1 s senza batch
+void batch_subscriber_task(DataReader *reader, std::vector<long> *recv_ns) {
+	receive_samples<SystemStatsBatch>(reader, *recv_ns, [recv_ns](const SystemStatsBatch &batch) {
+		long t = now_ns();
+		long marked = 0;
+		for (const SystemStatsV2 &s : batch.samples()) marked += mark_arrival(*recv_ns, s.packet_id(), t);
+		return marked;
+	});
+}
+
+struct RunResult {
+	long received = 0;
+	long batches = 0;
+	double samples_per_s = 0;                   // solo nel tetto
+	LatencyHistogram latency;                   // solo nella latenza
+};
+
+// period_us = 0: senza pause, misura il tetto; altrimenti un campione ogni period_us e misura la latenza
+RunResult run(size_t batch_size, long samples, long period_us, int window_ms) {
+	RunResult r;
+	Endpoints e = create_batch_endpoints();
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	TelemetryBatcher batcher;
+	batcher.configure(batch_size, window_ms);
+	std::vector<long> send_ns(samples, 0), recv_ns(samples, 0);
+	std::thread sub(batch_subscriber_task, e.reader, &recv_ns);
+
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	long start = now_ns();
+	for (long i = 0; i < samples; i++) {
+		if (period_us > 0) {
+			timespec_add_ns(&next, period_us * 1000);
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		}
+		send_ns[i] = now_ns();
+		SystemStatsV2 &s = batcher.next();
+		s.packet_id((uint32_t) i);
+		s.roll(0.1f);
+		s.pitch(0.05f);
+		s.altitude(5000.0f + (i % 1000));
+		s.speed(100.0f);
+		if (batcher.due()) {
+			e.writer->write(&batcher.pending());
+			batcher.sent();
+			r.batches++;
+		}
+	}
+	if (!batcher.empty()) {
+		e.writer->write(&batcher.pending());
+		r.batches++;
+	}
+	sub.join();
+
+	r.latency = arrival_latency(send_ns, recv_ns);
+	r.received = (long) r.latency.total;
+	long last_recv = recv_ns.empty() ? start : *std::max_element(recv_ns.begin(), recv_ns.end());
+	if (last_recv > start) r.samples_per_s = r.received / ((last_recv - start) / 1e9);
+
+	delete_endpoints(e);
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./TelemetryBatchBench [campioni] [periodo_us] [finestra_ms]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 200000;
+	long period_us = (argc > 2) ? std::stol(argv[2]) : 500;
+	int window_ms = (argc > 3) ? std::stoi(argv[3]) : TELEMETRY_BATCH_WINDOW_MS;
+
+	bench_library_settings();
+
+	const size_t sizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256 };
+
+	std::cout << "--- Tetto: " << samples << " campioni senza pause (dominio 1) ---\n";
+	std::cout << std::setw(8) << "batch" << std::setw(12) << "ricevuti" << std::setw(12) << "batch DDS"
+			<< std::setw(16) << "campioni/s" << "\n";
+	for (size_t size : sizes) {
+		RunResult r = run(size, samples, 0, window_ms);
+		std::cout << std::setw(8) << size << std::setw(12) << r.received << std::setw(12) << r.batches
+				<< std::setw(16) << std::fixed << std::setprecision(0) << r.samples_per_s << "\n";
+	}
+
+	// qui basta meno: a 2 kHz 200000 campioni sarebbero 100 s per ogni riga
+	long paced = std::min(samples, 5000000L / std::max(period_us, 1L));
+	std::cout << "\n--- Latenza: " << paced << " campioni ogni " << period_us << " us, finestra " << window_ms << " ms ---\n";
+	for (size_t size : sizes) {
+		RunResult r = run(size, paced, period_us, window_ms);
+		std::string label = "batch " + std::to_string(size);
+		print_latency_row(label.c_str(), r.latency, 1000.0, "us");
+		std::printf("%-22s %ld batch DDS, media %.1f us\n", "", r.batches, r.latency.mean_ns() / 1000.0);
+	}
+	std::cout << "(latenza: dal riempimento del campione allo spacchettamento nel subscriber, attesa nel batch compresa)\n";
+	return 0;
+}
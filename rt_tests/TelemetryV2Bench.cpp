@@ -0,0 +1,132 @@
+//telemetria v1 (SystemStats, stato come string<32>) contro v2 (SystemStatsV2, codice enum e flag a bit):
+//byte serializzati per campione e CPU per campione, senza rete, chiamando direttamente i PubSubType
+//encode = riempio il campione dal frame del pilota + serialize, decode = deserialize + classificazione del monitor
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <time.h>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+#include "FlightComputer.hpp"
+#include "TelemetryVersion.hpp"
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastdds::rtps::SerializedPayload_t;
+
+long now_ns() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+// un frame per ogni codice di stato, così la classificazione non vede sempre la stessa stringa
+std::vector<FlightControls> make_states() {
+	std::vector<FlightControls> states;
+	FlightControls s{};
+	s.altitude = 5000.0f;
+	s.speed = 100.0f;
+	states.push_back(s);                 // NOMINAL FLIGHT
+	s.aileron = 1.4f;
+	states.push_back(s);                 // WARN: HIGH BANK ANGLE
+	s.aileron = 0.0f;
+	s.autopilot_engaged = true;
+	s.recovery_bank = true;
+	states.push_back(s);                 // AUTOPILOT: RECOVERY
+	s.altitude = 800.0f;
+	states.push_back(s);                 // ALARM: TERRAIN PULL UP
+	s.altitude = 13000.0f;
+	states.push_back(s);                 // ALARM: HIGH ALTITUDE
+	for (size_t i = 0; i < states.size(); i++) states[i].packet_id = (long) i;
+	return states;
+}
+
+// Classificazione di MonitorApp prima della v2: ricerche nella stringa a ogni campione
+int classify_v1_find(const SystemStats& t) {
+	std::string status = t.status_msg().c_str();
+	if (status.find("ALARM") != std::string::npos || status.find("PULL UP") != std::string::npos ||
+		status.find("QUOTA BASSA") != std::string::npos || status.find("PULL DOWN") != std::string::npos ||
+		status.find("HIGH ALTITUDE") != std::string::npos) return 2;
+	return status.find("WARN") != std::string::npos ? 1 : 0;
+}
+
+int classify_v2(const SystemStatsV2& t) {
+	if (is_alarm(t.status())) return 2;
+	return is_warning(t.status()) ? 1 : 0;
+}
+
+// MonitorApp attuale quando riceve ancora la v1: conversione (strcmp) e poi il codice
+int classify_v1_to_v2(const SystemStats& t) {
+	SystemStatsV2 v2;
+	to_v2(t, v2);
+	return classify_v2(v2);
+}
+
+struct CodecResult {
+	double avg_size = 0;   // byte serializzati per campione (con i 4 di encapsulation)
+	uint32_t max_size = 0; // max_serialized_type_size del tipo
+	double encode_ns = 0;
+	double decode_ns = 0;
+	long classified = 0;   // somma delle classi, serve solo a non far sparire il ciclo
+};
+
+template <typename Sample, typename PubSubType>
+CodecResult run(const std::vector<FlightControls>& states, long samples,
+		void (*fill)(const FlightControls&, Sample&), int (*classify)(const Sample&)) {
+	CodecResult r;
+	PubSubType type;
+	r.max_size = type.max_serialized_type_size;
+
+	// un payload già serializzato per ogni frame, li usa il decode
+	std::vector<SerializedPayload_t> payloads(states.size());
+	Sample sample;
+	for (size_t k = 0; k < states.size(); k++) {
+		fill(states[k], sample);
+		r.avg_size += type.calculate_serialized_size(&sample, XCDR2_DATA_REPRESENTATION);
+		payloads[k].reserve(r.max_size);
+		type.serialize(&sample, payloads[k], XCDR2_DATA_REPRESENTATION);
+	}
+	r.avg_size /= states.size();
+
+	SerializedPayload_t payload;
+	payload.reserve(r.max_size);
+	long start = now_ns();
+	for (long i = 0; i < samples; i++) {
+		fill(states[i % states.size()], sample);
+		type.serialize(&sample, payload, XCDR2_DATA_REPRESENTATION);
+	}
+	r.encode_ns = (double) (now_ns() - start) / samples;
+
+	start = now_ns();
+	for (long i = 0; i < samples; i++) {
+		type.deserialize(payloads[i % states.size()], &sample);
+		r.classified += classify(sample);
+	}
+	r.decode_ns = (double) (now_ns() - start) / samples;
+	return r;
+}
+
+void print_row(const char* name, const CodecResult& r) {
+	std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(8) << r.avg_size << " B" << std::setw(8) << r.max_size << " B"
+			<< std::setw(10) << r.encode_ns << " ns" << std::setw(10) << r.decode_ns << " ns"
+			<< std::setw(12) << r.classified << "\n";
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./TelemetryV2Bench [campioni]
+	long samples = (argc > 1) ? std::stol(argv[1]) : 2000000;
+	std::vector<FlightControls> states = make_states();
+
+	std::cout << "--- Telemetria v1 contro v2: " << samples << " campioni, XCDR2 ---\n";
+	std::cout << std::left << std::setw(34) << "formato" << std::right
+			<< std::setw(10) << "media" << std::setw(10) << "max"
+			<< std::setw(13) << "encode" << std::setw(13) << "decode" << std::setw(12) << "classi" << "\n";
+
+	print_row("v1 (string<32>, find)", run<SystemStats, SystemStatsPubSubType>(states, samples, fill_system_stats, classify_v1_find));
+	print_row("v1 -> v2 (strcmp all'arrivo)", run<SystemStats, SystemStatsPubSubType>(states, samples, fill_system_stats, classify_v1_to_v2));
+	print_row("v2 (enum + bitmask)", run<SystemStatsV2, SystemStatsV2PubSubType>(states, samples, fill_system_stats_v2, classify_v2));
+
+	std::cout << "(encode: riempimento + serialize; decode: deserialize + classificazione; per campione)\n";
+	return 0;
+}
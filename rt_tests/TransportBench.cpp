@@ -0,0 +1,85 @@
+//telemetria v1 (SystemStats) a frequenza fissa con i profili di trasporto di TransportProfile.hpp:
+//solo memoria condivisa, solo UDP su loopback e consegna intraprocesso. Per ogni profilo e frequenza:
+//percentili della latenza (dalla write alla take nel subscriber) e CPU di tutto il processo per messaggio.
+//Publisher e subscriber sono due participant dello stesso processo, la consegna intraprocesso è accesa solo con intra
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <string>
+#include <time.h>
+#include "Telemetry.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "BenchCommon.hpp"
+
+using namespace eprosima::fastdds::dds;
+
+struct RunResult {
+	LatencyHistogram latency;
+	double cpu_us_per_msg = 0;
+};
+
+RunResult run(TransportProfile profile, int rate_hz, int seconds) {
+	RunResult r;
+	// la consegna intraprocesso si può cambiare solo quando non c'è nessun participant
+	if (!select_transport_library(profile)) {
+		std::cerr << "Impostazioni della libreria rifiutate per " << transport_profile_name(profile) << "\n";
+		return r;
+	}
+	// niente data-sharing: ogni campione deve passare dal trasporto del profilo
+	DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+	DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+	wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	rqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+	wqos.data_sharing().off();
+	rqos.data_sharing().off();
+	Endpoints e = create_endpoints("TransportBench", profile, [] { return new SystemStatsPubSubType(); }, "TelemetryTopic", wqos, rqos);
+	if (!wait_for_match(e)) {
+		delete_endpoints(e);
+		return r;
+	}
+
+	long samples = (long) rate_hz * seconds;
+	long period_us = 1000000L / rate_hz;
+	std::vector<long> send_ns(samples, 0), recv_ns(samples, 0);
+	SystemStats sample;
+	sample.speed(100.0f);
+	sample.status_msg("NOMINAL FLIGHT");
+
+	long cpu_start = cpu_us(RUSAGE_SELF);
+	std::thread sub(subscriber_task<SystemStats>, e.reader, &recv_ns);
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (long i = 0; i < samples; i++) {
+		timespec_add_ns(&next, period_us * 1000);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+		sample.packet_id((uint32_t) i);
+		sample.altitude(5000.0f + (i % 1000));
+		send_ns[i] = now_ns();
+		e.writer->write(&sample);
+	}
+	sub.join();
+	long cpu = cpu_us(RUSAGE_SELF) - cpu_start;
+
+	r.latency = arrival_latency(send_ns, recv_ns);
+	if (r.latency.total > 0) r.cpu_us_per_msg = (double) cpu / r.latency.total;
+	delete_endpoints(e);
+	return r;
+}
+
+int main(int argc, char *argv[]) {
+
+	// USO: ./TransportBench [secondi]
+	int seconds = (argc > 1) ? std::stoi(argv[1]) : 5;
+
+	std::cout << "--- SystemStats a frequenza fissa per " << seconds << " s con ogni profilo di trasporto (dominio 1) ---\n";
+	for (TransportProfile profile : { TransportProfile::SHM, TransportProfile::UDP, TransportProfile::INTRA }) {
+		for (int rate_hz : { 100, 1000, 10000 }) {
+			RunResult r = run(profile, rate_hz, seconds);
+			std::string label = std::string(transport_profile_name(profile)) + " " + std::to_string(rate_hz) + " Hz";
+			print_latency_row(label.c_str(), r.latency, 1000.0, "us");
+			std::printf("%-22s CPU/msg %.1f us\n", "", r.cpu_us_per_msg);
+		}
+	}
+	std::cout << "(latenza: dalla write alla take nel subscriber; CPU/msg: tutto il processo diviso per i campioni ricevuti)\n";
+	return 0;
+}
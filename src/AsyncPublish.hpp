@@ -0,0 +1,138 @@
+//pubblicazione asincrona: il job real-time mette il campione in una SpscQueue e torna subito, la write DDS
+//(serializzazione e invio RTPS) la fa un thread writer a priorità più bassa su un altro core. Così il tempo
+//della write non entra più nel tempo di risposta del job. A coda piena il campione si scarta e si conta,
+//il job non aspetta mai il writer. In coda vanno tipi plain (FlightControls, SystemStatsPlain, SystemStatsV2):
+//il push è una copia nel buffer già allocato, la conversione nel tipo del topic la fa il writer
+#ifndef ASYNC_PUBLISH_HPP
+#define ASYNC_PUBLISH_HPP
+
+#include "SharedMemory.hpp"
+#include "SpscQueue.hpp"
+#include "RtThread.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <thread>
+
+template <typename T, size_t CAPACITY>
+class AsyncPublishStage {
+public:
+    using Publish = std::function<void(const T&)>;
+    // quanto può dormire il writer a coda vuota (-1 = senza limite), poi chiama Idle (per esempio il flush di un batch)
+    using Timeout = std::function<int()>;
+    using Idle = std::function<void()>;
+
+private:
+    SpscQueue<T, CAPACITY> queue;
+    FutexEvent event;                         // il job sveglia il writer, syscall solo se il writer dorme
+    std::atomic<bool> stop{false};
+    alignas(64) std::atomic<long> dropped{0}; // campioni scartati a coda piena (lo scrive solo il job)
+    std::atomic<size_t> high_water{0};
+    long published = 0;                       // solo il writer, si legge dopo stop()
+    std::thread worker;
+
+    void run(Publish publish, Timeout timeout, Idle idle, int core, int priority) {
+        pin_current_thread(core, priority);
+        T batch[32];
+        while (true) {
+            uint32_t ev = event.value();
+            size_t n = queue.pop_batch(batch, 32);
+            if (n > 0) {
+                for (size_t i = 0; i < n; i++) publish(batch[i]);
+                published += n;
+                continue;
+            }
+            if (stop.load()) break;
+            if (!event.wait(ev, timeout ? timeout() : -1) && idle) idle();
+        }
+    }
+
+public:
+    // core < 0 e priority <= 0 come pin_current_thread: il writer deve stare sotto al job che lo alimenta
+    void start(Publish publish, int core, int priority, Timeout timeout = nullptr, Idle idle = nullptr) {
+        worker = std::thread(&AsyncPublishStage::run, this, publish, timeout, idle, core, priority);
+    }
+
+    // Lato job real-time: niente lock, e niente allocazioni se T è plain; false se la coda è piena
+    bool push(const T& value) {
+        if (!queue.try_push(value)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        size_t depth = queue.size();
+        if (depth > high_water.load(std::memory_order_relaxed)) high_water.store(depth, std::memory_order_relaxed);
+        event.notify_all();
+        return true;
+    }
+
+    // Il writer svuota quello che resta in coda ed esce
+    void shutdown() {
+        if (!worker.joinable()) return;
+        stop.store(true);
+        event.notify_all();
+        worker.join();
+    }
+
+    ~AsyncPublishStage() { shutdown(); }
+
+    long dropped_count() const { return dropped.load(std::memory_order_relaxed); }
+    size_t high_water_mark() const { return high_water.load(std::memory_order_relaxed); }
+    long published_count() const { return published; }
+
+    void print_counters(const char* name) const {
+        std::printf("[ASYNC %s] capacita': %zu | pubblicati: %ld | scartati: %ld | high-water: %zu\n",
+                    name, CAPACITY, published, dropped_count(), high_water_mark());
+    }
+};
+
+// Pubblicazione di un job periodico dei test real-time (DDSCORE, DDSMCORE, DDSEDF*, AsyncPublishBench):
+// sincrona, con la write nel job, oppure asincrona, con il push nel job e la write nel thread writer
+template <typename T, size_t CAPACITY = 256>
+class JobPublisher {
+    typename AsyncPublishStage<T, CAPACITY>::Publish write;
+    std::unique_ptr<AsyncPublishStage<T, CAPACITY>> stage;
+
+public:
+    // async: il thread writer parte subito su core con priority (SCHED_FIFO se > 0), sotto al job
+    JobPublisher(typename AsyncPublishStage<T, CAPACITY>::Publish publish, bool async, int core, int priority)
+        : write(publish) {
+        if (!async) return;
+        stage.reset(new AsyncPublishStage<T, CAPACITY>());
+        stage->start(write, core, priority);
+    }
+
+    bool async() const { return stage != nullptr; }
+
+    void publish(const T& value) {
+        if (stage) stage->push(value);
+        else write(value);
+    }
+
+    // alla fine del test il writer svuota la coda; con name stampa anche i contatori (solo se asincrona)
+    void finish(const char* name = nullptr) {
+        if (!stage) return;
+        stage->shutdown();
+        if (name != nullptr) stage->print_counters(name);
+    }
+
+    long dropped_count() const { return stage ? stage->dropped_count() : 0; }
+};
+
+// Tempo di risposta di un job (dal risveglio alla fine del lavoro) su tutto il test, per le tabelle finali
+struct JobResponse {
+    double sum_ms = 0.0;
+    double max_ms = 0.0;
+    long jobs = 0;
+
+    void record(double ms) {
+        sum_ms += ms;
+        if (ms > max_ms) max_ms = ms;
+        jobs++;
+    }
+
+    double avg_ms() const { return jobs > 0 ? sum_ms / jobs : 0.0; }
+};
+
+#endif
@@ -0,0 +1,128 @@
+//layout della dashboard di MonitorApp su una TerminalGrid: stesse righe, colori e soglie della stampa di prima,
+//ma in posizioni fisse, così fra un frame e l'altro cambiano solo i numeri e nel terminale vanno solo quelli.
+//DashboardFrame è tutto quello che serve per un frame, la usa anche il benchmark del disegno
+#ifndef DASHBOARD_VIEW_HPP
+#define DASHBOARD_VIEW_HPP
+
+#include "TelemetryVersion.hpp"
+#include "LatencyHistogram.hpp"
+#include "TerminalGrid.hpp"
+#include "SequenceTracker.hpp"
+#include <cmath>
+#include <cstdint>
+
+constexpr int DASHBOARD_COLS = 72;
+constexpr int DASHBOARD_ROWS = 30;
+
+struct DashboardFrame {
+    SystemStatsV2 telemetry;
+    float cycle_time = 0.0f; // ms fra gli ultimi due arrivi
+    float avg_jitter = 0.0f; // ms, media della finestra
+    long total_packets = 0;
+    SequenceTotals sequence;       // writer dell'aereo a schermo
+    SequenceTotals fleet_sequence; // tutti i writer (solo fleet)
+    bool decimated = false;        // reader filtrato: i buchi nei packet_id non sono perdite
+    const RollingLatency* cycle = nullptr;
+    const RollingLatency* jitter = nullptr;
+    const RollingLatency* response = nullptr;
+    bool fleet = false;      // riga FLOTTA solo con la telemetria fleet
+    uint32_t aircraft_id = 0;
+    size_t fleet_size = 0;
+    size_t fleet_alive = 0;
+    long fleet_packets = 0;
+    long dropped = 0;        // eventi persi a coda piena fra listener e dashboard
+};
+
+inline void draw_percentiles(TerminalGrid& grid, int row, const char* label, const char* period, const LatencyHistogram& h) {
+    int col = grid.format(row, 0, STYLE_NORMAL, " %-11s%-10s", label, period);
+    for (double p : { 50.0, 90.0, 99.0, 99.9 }) col = grid.format(row, col, STYLE_NORMAL, "%9.2f", h.percentile(p) / 1e6);
+    grid.format(row, col, STYLE_NORMAL, "%9.2f", h.max_ns / 1e6);
+}
+
+inline void draw_dashboard(TerminalGrid& grid, const DashboardFrame& f) {
+    const SystemStatsV2& telemetry = f.telemetry;
+    const SequenceTotals& seq = f.sequence;
+    const char* status = status_text(telemetry.status());
+
+    // il codice di stato sostituisce le ricerche nella stringa
+    bool alarm_crit = (is_alarm(telemetry.status()) ||
+                       telemetry.altitude() < 200.0f ||
+                       telemetry.altitude() > 15000.0f);
+    bool alarm_warn = (is_warning(telemetry.status()) || f.avg_jitter > 5.0f);
+
+    grid.clear();
+    CellStyle banner = alarm_crit ? STYLE_BANNER_RED : alarm_warn ? STYLE_BANNER_YELLOW : STYLE_BANNER_BLUE;
+    grid.text(0, 0, banner, "############################################################");
+    grid.text(1, 0, banner, "           TORRE DI CONTROLLO - MONITORAGGIO REAL-TIME      ");
+    grid.text(2, 0, banner, "############################################################");
+
+    grid.text(4, 0, STYLE_CYAN, ">>> TELEMETRIA DI VOLO <<<");
+    grid.text(4, 38, STYLE_MAGENTA, ">>> DIAGNOSTICA CORE & THREAD <<<");
+
+    int col = grid.format(5, 0, STYLE_NORMAL, " ALTITUDINE : %5d m ", (int) telemetry.altitude());
+    col = grid.text(5, col, STYLE_RED, telemetry.altitude() < 200.0f || telemetry.altitude() > 14000.0f ? "[CRIT]" : "      ");
+    col = grid.format(5, col, STYLE_NORMAL, "   |   Cycle Time : %.2f ms ", f.cycle_time);
+    if (f.cycle_time > 55 || f.cycle_time < 45) grid.text(5, col, STYLE_YELLOW, "[UNSTABLE]");
+    else grid.text(5, col, STYLE_GREEN, "[OK]");
+
+    col = grid.format(6, 0, STYLE_NORMAL, " ROLL (X)   : %6.2f rad ", telemetry.roll());
+    col = grid.text(6, col, STYLE_YELLOW, std::abs(telemetry.roll()) > 1.2 ? "[WARN]" : "      ");
+    col = grid.format(6, col, STYLE_NORMAL, "   |   Jitter Avg : %5.2f ms ", f.avg_jitter);
+    if (f.avg_jitter > 2.0) grid.text(6, col, STYLE_RED, "[LAG]");
+    else grid.text(6, col, STYLE_GREEN, "[SMOOTH]");
+
+    col = grid.format(7, 0, STYLE_NORMAL, " PITCH (Y)  : %6.2f rad       ", telemetry.pitch());
+    grid.format(7, col, STYLE_NORMAL, "   |   RAM Access : %5d us", (int) telemetry.latency_us());
+
+    col = grid.format(8, 0, STYLE_NORMAL, " YAW (Z)    : %6.2f rad ", telemetry.yaw());
+    col = grid.text(8, col, STYLE_YELLOW, std::abs(telemetry.yaw()) > 1.2 ? "[WARN]" : "      ");
+    if (f.decimated) grid.text(8, col, STYLE_NORMAL, "   |   Packet Loss   : n/d (decimato)");
+    else grid.format(8, col, STYLE_NORMAL, "   |   Packet Loss   : %.1f %%", seq.loss_percent());
+
+    grid.format(9, 0, STYLE_NORMAL, " SPEED      : %6d Km/h", (int) telemetry.speed() * 2);
+
+    col = grid.text(11, 0, STYLE_NORMAL, " STATO CARICO CPU (Jitter): ");
+    grid.bar(11, col, f.avg_jitter, 10.0f, 20, STYLE_YELLOW);
+    col = grid.text(12, 0, STYLE_NORMAL, " STATO ALTITUDINE (Quota) : ");
+    grid.bar(12, col, telemetry.altitude(), 15000.0f, 20, STYLE_GREEN);
+
+    col = grid.text(14, 0, STYLE_CYAN, " PERCENTILI (ms)      ");
+    grid.format(14, col, STYLE_NORMAL, "%9s%9s%9s%9s%9s", "p50", "p90", "p99", "p99.9", "max");
+    if (f.cycle != nullptr && f.jitter != nullptr && f.response != nullptr) {
+        draw_percentiles(grid, 15, "Cycle Time", "10 s", f.cycle->recent());
+        draw_percentiles(grid, 16, "", "run", f.cycle->run);
+        draw_percentiles(grid, 17, "Jitter", "10 s", f.jitter->recent());
+        draw_percentiles(grid, 18, "", "run", f.jitter->run);
+        draw_percentiles(grid, 19, "Risposta", "10 s", f.response->recent());
+        draw_percentiles(grid, 20, "", "run", f.response->run);
+    }
+
+    grid.text(22, 0, STYLE_NORMAL, "------------------------------------------------------------");
+    col = grid.text(23, 0, STYLE_NORMAL, "CONDIZIONE VOLO : ");
+    if (alarm_crit) grid.format(23, col, STYLE_RED, " !!! IN PERICOLO: %s (WARNING) !!!", status);
+    else grid.format(23, col, alarm_warn ? STYLE_YELLOW : STYLE_GREEN, " %s", status);
+
+    // buchi nei packet_id da un capo all'altro: frame sovrascritti sul bus (MUTEX, SEQLOCK), code piene dello stadio
+    // async e del batcher, poi DDS. Con il reader decimato i buchi li fa il filtro: si contano solo gli arrivi
+    if (f.decimated) {
+        grid.format(24, 0, STYLE_NORMAL, " PERSE E2E  : %ld Rx | perse n/d (decimato)", f.total_packets);
+    } else {
+        grid.format(24, 0, STYLE_NORMAL, " PERSE E2E  : %ld Rx | %ld Perse + %ld in attesa (%.1f%%)",
+                    f.total_packets, seq.lost, seq.pending, seq.loss_percent());
+    }
+    col = grid.format(25, 0, STYLE_NORMAL, " SEQUENZA   : %ld dup | %ld fuori ordine | %ld vecchi",
+                      seq.duplicates, seq.reordered, seq.stale);
+    grid.format(25, col, STYLE_NORMAL, " | %zu writer", seq.writers);
+    if (f.fleet) {
+        col = grid.format(26, 0, STYLE_NORMAL, " FLOTTA     : aereo #%u di %zu (%zu in volo) | %ld Rx totali",
+                          f.aircraft_id, f.fleet_size, f.fleet_alive, f.fleet_packets);
+        if (!f.decimated) grid.format(26, col, STYLE_NORMAL, " | %.1f%% perse e2e", f.fleet_sequence.loss_percent());
+    }
+    if (f.dropped > 0) grid.format(27, 0, STYLE_NORMAL, " DASHBOARD  : %ld eventi persi (coda piena)", f.dropped);
+    grid.text(28, 0, STYLE_NORMAL, "------------------------------------------------------------");
+
+    if (f.avg_jitter > 10.0f) grid.text(29, 0, STYLE_RED, " [!] ALERT: IL SISTEMA SINGLE CORE E' SOVRACCARICO! ");
+    else grid.text(29, 0, STYLE_GREEN, " [OK] Scheduling Thread Ottimale. ");
+}
+
+#endif
@@ -0,0 +1,130 @@
+//tabella hash piatta con chiave uint32_t (per esempio aircraft_id) o di byte fissi (std::array<uint8_t, N>, i GUID
+//delle statistiche Fast DDS): chiavi e valori in due vettori contigui,
+//indirizzamento aperto con sondaggio lineare, niente nodi allocati per elemento. Si raddoppia quando è piena a metà,
+//quindi con reserve() fatta all'avvio per il numero di aerei previsto a regime non alloca più.
+//I posti occupati li segna un vettore a parte: tutte le chiavi sono valide, anche 0xFFFFFFFF
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+template <typename Key>
+struct FlatHash;
+
+// Fibonacci hashing: gli id consecutivi della flotta finiscono sparsi nella tabella
+template <>
+struct FlatHash<uint32_t> {
+    size_t operator()(uint32_t key) const { return (size_t) ((key * 0x9E3779B97F4A7C15ull) >> 32); }
+};
+
+// FNV-1a sui byte della chiave
+template <size_t N>
+struct FlatHash<std::array<uint8_t, N>> {
+    size_t operator()(const std::array<uint8_t, N>& key) const {
+        uint64_t h = 1469598103934665603ULL;
+        for (uint8_t b : key) h = (h ^ b) * 1099511628211ULL;
+        return (size_t) h;
+    }
+};
+
+template <typename Value, typename Key = uint32_t>
+class FlatHashMap {
+    std::vector<uint8_t> used; // 1 se il posto è occupato
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    size_t count = 0;
+    size_t mask = 0;
+
+    static size_t hash(const Key& key) { return FlatHash<Key>()(key); }
+
+    void rehash(size_t capacity) {
+        std::vector<uint8_t> old_used(capacity, 0);
+        std::vector<Key> old_keys(capacity);
+        std::vector<Value> old_values(capacity);
+        old_used.swap(used);
+        old_keys.swap(keys);
+        old_values.swap(values);
+        mask = capacity - 1;
+        count = 0;
+        for (size_t i = 0; i < old_keys.size(); i++) {
+            if (old_used[i]) insert_new(old_keys[i], std::move(old_values[i]));
+        }
+    }
+
+    Value& insert_new(const Key& key, Value&& value) {
+        size_t i = hash(key) & mask;
+        while (used[i]) i = (i + 1) & mask;
+        used[i] = 1;
+        keys[i] = key;
+        values[i] = std::move(value);
+        count++;
+        return values[i];
+    }
+
+public:
+    explicit FlatHashMap(size_t expected = 8) { reserve(expected); }
+
+    // posto per expected elementi senza rehash (capacità potenza di due, carico massimo 1/2)
+    void reserve(size_t expected) {
+        size_t capacity = 16;
+        while (capacity < expected * 2) capacity *= 2;
+        if (capacity > keys.size()) rehash(capacity);
+    }
+
+    Value* find(const Key& key) {
+        if (keys.empty()) return nullptr;
+        for (size_t i = hash(key) & mask; used[i]; i = (i + 1) & mask) {
+            if (keys[i] == key) return &values[i];
+        }
+        return nullptr;
+    }
+
+    // il valore della chiave, creato con Value() se non c'era
+    Value& operator[](const Key& key) {
+        Value* v = find(key);
+        if (v != nullptr) return *v;
+        if ((count + 1) * 2 > keys.size()) rehash(keys.size() * 2);
+        return insert_new(key, Value());
+    }
+
+    // toglie la chiave, false se non c'era. Niente lapidi: le chiavi successive della stessa catena di sondaggio
+    // tornano indietro a coprire il buco, così find() continua a fermarsi al primo posto libero
+    bool erase(const Key& key) {
+        if (keys.empty()) return false;
+        size_t i = hash(key) & mask;
+        while (used[i] && !(keys[i] == key)) i = (i + 1) & mask;
+        if (!used[i]) return false;
+        used[i] = 0;
+        count--;
+        for (size_t j = (i + 1) & mask; used[j]; j = (j + 1) & mask) {
+            size_t home = hash(keys[j]) & mask;
+            // keys[j] può andare nel buco i solo se i sta fra la sua posizione di partenza e j
+            if (((j - home) & mask) < ((j - i) & mask)) continue;
+            keys[i] = keys[j];
+            values[i] = std::move(values[j]);
+            used[i] = 1;
+            used[j] = 0;
+            i = j;
+        }
+        return true;
+    }
+
+    template <typename F>
+    void for_each(F f) {
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (used[i]) f(keys[i], values[i]);
+        }
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return keys.size(); }
+
+    // byte occupati dalla tabella (senza la memoria che i valori eventualmente allocano per conto loro)
+    size_t memory_bytes() const { return used.capacity() + keys.capacity() * sizeof(Key) + values.capacity() * sizeof(Value); }
+};
+
+#endif
@@ -0,0 +1,208 @@
+//flotta di aerei in struttura di array (SoA): ogni grandezza in un suo array così un passo
+//della fisica aggiorna FLEET_LANES aerei per istruzione. Le recovery diventano maschere (0 / -1 per aereo)
+//e i rami if di fbw_step diventano select, nessun salto dipendente dai dati
+#ifndef FLEET_PHYSICS_HPP
+#define FLEET_PHYSICS_HPP
+
+#include "FlightPhysics.hpp"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// un registro intero: 8 float con AVX (-march=native), altrimenti 4 come SSE/NEON
+#if defined(__AVX__)
+constexpr size_t FLEET_LANES = 8;
+#else
+constexpr size_t FLEET_LANES = 4;
+#endif
+typedef float fleet_vf __attribute__((vector_size(FLEET_LANES * sizeof(float))));
+typedef int32_t fleet_vi __attribute__((vector_size(FLEET_LANES * sizeof(int32_t))));
+
+class FleetState {
+    size_t count;
+
+public:
+    // gli array sono allungati a un multiplo di FLEET_LANES, gli aerei in più volano ma non si leggono
+    std::vector<float> roll, pitch, yaw, altitude, x, z, speed;
+    std::vector<int32_t> landing, recovery_low, recovery_high, recovery_bank, recovery_zero;
+
+    explicit FleetState(size_t n) : count(n) {
+        size_t padded = (n + FLEET_LANES - 1) / FLEET_LANES * FLEET_LANES;
+        for (auto* v : { &roll, &pitch, &yaw, &altitude, &x, &z, &speed }) v->assign(padded, 0.0f);
+        for (auto* v : { &landing, &recovery_low, &recovery_high, &recovery_bank, &recovery_zero }) v->assign(padded, 0);
+        altitude.assign(padded, 5000.0f);
+        speed.assign(padded, 100.0f);
+    }
+
+    size_t size() const { return count; }
+    size_t padded_size() const { return roll.size(); }
+
+    void set(size_t i, const PlaneData& p, const FbwState& fbw = FbwState()) {
+        roll[i] = p.roll;
+        pitch[i] = p.pitch;
+        yaw[i] = p.yaw;
+        altitude[i] = p.altitude;
+        x[i] = p.x;
+        z[i] = p.z;
+        speed[i] = p.speed;
+        landing[i] = p.landing_mode ? -1 : 0;
+        recovery_low[i] = fbw.recovery_low ? -1 : 0;
+        recovery_high[i] = fbw.recovery_high ? -1 : 0;
+        recovery_bank[i] = fbw.recovery_bank ? -1 : 0;
+        recovery_zero[i] = fbw.recovery_zero ? -1 : 0;
+    }
+
+    PlaneData get(size_t i) const {
+        PlaneData p{};
+        p.roll = roll[i];
+        p.pitch = pitch[i];
+        p.yaw = yaw[i];
+        p.altitude = altitude[i];
+        p.x = x[i];
+        p.z = z[i];
+        p.speed = speed[i];
+        p.landing_mode = landing[i] != 0;
+        return p;
+    }
+
+    FbwState get_fbw(size_t i) const {
+        FbwState fbw;
+        fbw.recovery_low = recovery_low[i] != 0;
+        fbw.recovery_high = recovery_high[i] != 0;
+        fbw.recovery_bank = recovery_bank[i] != 0;
+        fbw.recovery_zero = recovery_zero[i] != 0;
+        return fbw;
+    }
+};
+
+// Riferimento: un aereo alla volta con fbw_step, lo stesso codice di FlightSim
+inline void fleet_step_scalar(FleetState& f, float dt_scale) {
+    for (size_t i = 0; i < f.size(); i++) {
+        PlaneData p = f.get(i);
+        FbwState fbw = f.get_fbw(i);
+        fbw_step(p, fbw, dt_scale);
+        f.set(i, p, fbw);
+    }
+}
+
+namespace fleet_simd {
+
+inline fleet_vf load(const float* p) { fleet_vf v; std::memcpy(&v, p, sizeof(v)); return v; }
+inline fleet_vi load(const int32_t* p) { fleet_vi v; std::memcpy(&v, p, sizeof(v)); return v; }
+inline void store(float* p, fleet_vf v) { std::memcpy(p, &v, sizeof(v)); }
+inline void store(int32_t* p, fleet_vi v) { std::memcpy(p, &v, sizeof(v)); }
+
+inline fleet_vf splat(float a) { return fleet_vf{} + a; }
+inline fleet_vi splat_i(int32_t a) { return fleet_vi{} + a; }
+
+// m ? a : b per ogni corsia (m vale 0 oppure -1)
+inline fleet_vf select(fleet_vi m, fleet_vf a, fleet_vf b) {
+    return (fleet_vf) (((fleet_vi) a & m) | ((fleet_vi) b & ~m));
+}
+inline fleet_vf vabs(fleet_vf a) { return (fleet_vf) ((fleet_vi) a & splat_i(0x7fffffff)); }
+
+// sin e cos insieme: riduzione a [-pi/4, pi/4] e polinomi di cephes (errore ~1e-7 nel range ridotto)
+inline void sincos(fleet_vf a, fleet_vf& s, fleet_vf& c) {
+    fleet_vf t = a * splat(0.63661977236758134f); // 2/pi
+    fleet_vi q = __builtin_convertvector(t + select(t >= 0.0f, splat(0.5f), splat(-0.5f)), fleet_vi);
+    fleet_vf qf = __builtin_convertvector(q, fleet_vf);
+    fleet_vf r = a - qf * splat(1.5703125f) - qf * splat(4.837512969970703125e-4f) - qf * splat(7.549789948768648e-8f);
+
+    fleet_vf r2 = r * r;
+    fleet_vf ps = r + r * r2 * (splat(-1.6666654611e-1f) + r2 * (splat(8.3321608736e-3f) + r2 * splat(-1.9515295891e-4f)));
+    fleet_vf pc = splat(1.0f) - splat(0.5f) * r2
+                + r2 * r2 * (splat(4.166664568298827e-2f) + r2 * (splat(-1.388731625493765e-3f) + r2 * splat(2.443315711809948e-5f)));
+
+    fleet_vi swap = (q & 1) != 0;
+    s = select(swap, pc, ps);
+    c = select(swap, ps, pc);
+    s = select((q & 2) != 0, -s, s);
+    c = select(((q + 1) & 2) != 0, -c, c);
+}
+
+} // namespace fleet_simd
+
+// Stesso passo di fbw_step su FLEET_LANES aerei alla volta
+inline void fleet_step_simd(FleetState& f, float dt_scale) {
+    using namespace fleet_simd;
+    const fleet_vf k = splat(dt_scale);
+    const fleet_vf decay = splat(step_decay(0.95f, dt_scale));
+    const fleet_vf zero = splat(0.0f);
+
+    for (size_t i = 0; i < f.padded_size(); i += FLEET_LANES) {
+        fleet_vf roll = load(&f.roll[i]);
+        fleet_vf pitch = load(&f.pitch[i]);
+        fleet_vf yaw = load(&f.yaw[i]);
+        fleet_vf alt = load(&f.altitude[i]);
+        fleet_vf speed = load(&f.speed[i]);
+        fleet_vi landing = load(&f.landing[i]);
+        fleet_vi low = load(&f.recovery_low[i]);
+        fleet_vi high = load(&f.recovery_high[i]);
+        fleet_vi bank = load(&f.recovery_bank[i]);
+        fleet_vi rzero = load(&f.recovery_zero[i]);
+
+        // aggancio delle recovery
+        low = ~landing & (low | ((alt < 2000.0f) & (speed >= 0.0f)));
+        rzero |= (speed < 10.0f) & (alt <= 2500.0f);
+        high |= alt > 13000.0f;
+        bank |= vabs(roll) > 1.2f;
+
+        // recovery_low
+        roll = select(low, roll * decay, roll);
+        pitch = select(low & (pitch < 0.3f), pitch + splat(0.005f) * k, pitch);
+        speed = select(low & (speed < 150.0f), speed + splat(0.5f) * k, speed);
+        low &= ~(alt >= 2500.0f);
+
+        // recovery_zero, altrimenti recovery_high
+        fleet_vi zero_active = rzero;
+        speed = select(zero_active & (speed < 100.0f), speed + splat(1.5f) * k, speed);
+        pitch = select(zero_active & (pitch < 0.2f), pitch + splat(0.01f) * k, pitch);
+        rzero &= ~((alt >= 2500.0f) & (speed >= 100.0f));
+
+        fleet_vi high_active = high & ~zero_active;
+        roll = select(high_active, roll * decay, roll);
+        fleet_vi nose_up = pitch > 0.0f;
+        pitch = select(high_active & nose_up, pitch - splat(0.05f) * k, pitch);
+        pitch = select(high_active & ~nose_up & (pitch > -0.2f), pitch - splat(0.005f) * k, pitch);
+        high &= ~(high_active & (alt <= 12000.0f));
+
+        // recovery_bank
+        fleet_vi right = roll > 0.15f;
+        fleet_vi left = roll < -0.15f;
+        roll = select(bank & right, roll - splat(0.015f) * k, roll);
+        roll = select(bank & left, roll + splat(0.015f) * k, roll);
+        bank &= right | left;
+
+        // integrazione
+        fleet_vf sp, cp, sy, cy;
+        sincos(pitch, sp, cp);
+        sincos(yaw, sy, cy);
+        fleet_vf speed_orizzontale = speed * cp;
+        fleet_vf speed_verticale = speed * sp;
+        speed_verticale = select(vabs(roll) > 0.8f, speed_verticale - splat(1.5f), speed_verticale);
+        speed_verticale = select(speed < 50.0f, speed_verticale - (splat(50.0f) - speed) * splat(0.05f), speed_verticale);
+
+        fleet_vf physics_scale = splat(0.015f) * k;
+        store(&f.x[i], load(&f.x[i]) + sy * speed_orizzontale * physics_scale);
+        store(&f.z[i], load(&f.z[i]) + cy * speed_orizzontale * physics_scale);
+        alt = alt + speed_verticale * splat(0.2f) * k;
+
+        // limiti
+        alt = select(alt < 0.0f, zero, alt);
+        roll = select(roll > 3.2f, splat(3.2f), roll);
+        roll = select(roll < -3.2f, splat(-3.2f), roll);
+        pitch = select(pitch > 1.5f, splat(1.5f), pitch);
+        pitch = select(pitch < -1.5f, splat(-1.5f), pitch);
+
+        store(&f.roll[i], roll);
+        store(&f.pitch[i], pitch);
+        store(&f.altitude[i], alt);
+        store(&f.speed[i], speed);
+        store(&f.recovery_low[i], low);
+        store(&f.recovery_high[i], high);
+        store(&f.recovery_bank[i], bank);
+        store(&f.recovery_zero[i], rzero);
+    }
+}
+
+#endif
@@ -0,0 +1,255 @@
+//campagna Monte Carlo sull'inviluppo di volo: migliaia di voli con stato iniziale e comandi casuali,
+//stessa fisica e fly-by-wire di FlightSim ma senza grafica e senza DDS, distribuiti su tutti i core.
+//Controlla che la quota non arrivi mai a 0 e che il rollio non resti sopra 1.2 rad troppo a lungo
+#include "FlightPhysics.hpp"
+#include "WorkStealingPool.hpp"
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <time.h>
+
+#define NUM_RECOVERY 4
+const char* recovery_names[NUM_RECOVERY] = { "LOW", "HIGH", "BANK", "ZERO" };
+
+constexpr long FLIGHTS_PER_JOB = 64;      // voli per lavoro del pool
+constexpr float BANK_LIMIT_RAD = 1.2f;    // stessa soglia dell'HUD e di recovery_bank
+constexpr int MAX_REPORTED_SEEDS = 8;     // voli con violazioni da stampare per rifarli, i primi per indice
+
+struct CampaignConfig {
+    long flights = 20000;
+    double duration_s = 60.0;
+    unsigned threads = 0;
+    int rate_hz = 60;
+    unsigned long seed = 1;
+    double bank_limit_s = 2.0; // rollio sopra BANK_LIMIT_RAD (a cloche rilasciata) più a lungo di così = violazione
+};
+
+// Risultati raccolti da un worker, si sommano alla fine senza lock
+struct alignas(64) CampaignStats {
+    long flights = 0;
+    long ground_contacts = 0;
+    long bank_violations = 0;
+    float min_altitude = 1e9f;
+    double sum_min_altitude = 0.0;
+    long min_altitude_buckets[6] = {}; // < 0 + 500, 1000, 1500, 2000, oltre
+
+    long episodes[NUM_RECOVERY] = {};
+    double recovery_s[NUM_RECOVERY] = {};
+    double max_recovery_s[NUM_RECOVERY] = {};
+    double max_bank_s = 0.0;
+
+    std::vector<long> bad_flights; // i MAX_REPORTED_SEEDS indici più bassi, in ordine: non dipende da chi ha volato cosa
+
+    void report_bad(long index) {
+        auto pos = std::lower_bound(bad_flights.begin(), bad_flights.end(), index);
+        if (pos - bad_flights.begin() >= MAX_REPORTED_SEEDS) return;
+        bad_flights.insert(pos, index);
+        if ((int) bad_flights.size() > MAX_REPORTED_SEEDS) bad_flights.pop_back();
+    }
+
+    void merge(const CampaignStats& o) {
+        flights += o.flights;
+        ground_contacts += o.ground_contacts;
+        bank_violations += o.bank_violations;
+        if (o.min_altitude < min_altitude) min_altitude = o.min_altitude;
+        sum_min_altitude += o.sum_min_altitude;
+        for (int i = 0; i < 6; i++) min_altitude_buckets[i] += o.min_altitude_buckets[i];
+        for (int r = 0; r < NUM_RECOVERY; r++) {
+            episodes[r] += o.episodes[r];
+            recovery_s[r] += o.recovery_s[r];
+            if (o.max_recovery_s[r] > max_recovery_s[r]) max_recovery_s[r] = o.max_recovery_s[r];
+        }
+        if (o.max_bank_s > max_bank_s) max_bank_s = o.max_bank_s;
+        for (long f : o.bad_flights) report_bad(f);
+    }
+};
+
+// Comandi casuali: ogni 0.5-3 s il pilota cambia cloche, timone e manetta, ogni asse resta al centro
+// nel 60% dei casi (il landing mode resta fuori, con il fly-by-wire disinserito toccare terra è previsto)
+PilotInput random_input(std::mt19937_64& rng) {
+    std::discrete_distribution<int> axis({ 0.6, 0.2, 0.2 });
+    std::uniform_real_distribution<float> u(0.0f, 1.0f);
+    PilotInput in;
+    int a = axis(rng);
+    in.pitch_up = a == 1;
+    in.pitch_down = a == 2;
+    a = axis(rng);
+    in.roll_left = a == 1;
+    in.roll_right = a == 2;
+    a = axis(rng);
+    in.yaw_left = a == 1;
+    in.yaw_right = a == 2;
+    a = axis(rng);
+    in.throttle_up = a == 1;
+    in.throttle_down = a == 2;
+    in.engine_cut = u(rng) < 0.05f;
+    return in;
+}
+
+// Un volo intero: il seme dipende solo dall'indice, così il risultato non dipende da chi lo esegue
+void fly(long index, const CampaignConfig& cfg, CampaignStats& out) {
+    std::mt19937_64 rng(cfg.seed * 1000003UL + (unsigned long) index);
+    std::uniform_real_distribution<float> altitude(1500.0f, 14000.0f);
+    std::uniform_real_distribution<float> speed(0.0f, 200.0f);
+    std::uniform_real_distribution<float> roll(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> pitch(-0.5f, 0.5f);
+    std::uniform_real_distribution<float> yaw(-3.14159f, 3.14159f);
+    std::uniform_real_distribution<double> hold_s(0.5, 3.0);
+
+    PlaneData Aereo{};
+    Aereo.altitude = altitude(rng);
+    Aereo.speed = speed(rng);
+    Aereo.roll = roll(rng);
+    Aereo.pitch = pitch(rng);
+    Aereo.yaw = yaw(rng);
+    FbwState fbw;
+
+    float dt_scale = step_scale((float) cfg.rate_hz);
+    double dt_s = 1.0 / cfg.rate_hz;
+    long steps = (long) (cfg.duration_s * cfg.rate_hz);
+
+    PilotInput input = random_input(rng);
+    double next_change_s = hold_s(rng);
+    float min_altitude = Aereo.altitude;
+    bool ground = false;
+    double bank_s = 0.0, longest_bank_s = 0.0;
+    double episode_s[NUM_RECOVERY] = {};
+
+    for (long i = 0; i < steps; i++) {
+        double t = i * dt_s;
+        if (t >= next_change_s) {
+            input = random_input(rng);
+            next_change_s = t + hold_s(rng);
+        }
+
+        apply_pilot_input(Aereo, input, dt_scale);
+        fbw_step(Aereo, fbw, dt_scale);
+
+        if (Aereo.altitude < min_altitude) min_altitude = Aereo.altitude;
+        if (Aereo.altitude <= 0.0f) ground = true;
+
+        // conta solo a cloche laterale rilasciata: se il pilota tiene l'alettone il rollio lo decide lui
+        bool pilot_rolling = input.roll_left || input.roll_right;
+        if (std::abs(Aereo.roll) > BANK_LIMIT_RAD && !pilot_rolling) {
+            bank_s += dt_s;
+            if (bank_s > longest_bank_s) longest_bank_s = bank_s;
+        } else {
+            bank_s = 0.0;
+        }
+
+        // durata di ogni episodio di recovery, dall'aggancio allo sgancio
+        bool active[NUM_RECOVERY] = { fbw.recovery_low, fbw.recovery_high, fbw.recovery_bank, fbw.recovery_zero };
+        for (int r = 0; r < NUM_RECOVERY; r++) {
+            if (active[r]) {
+                if (episode_s[r] == 0.0) out.episodes[r]++;
+                episode_s[r] += dt_s;
+                out.recovery_s[r] += dt_s;
+                if (episode_s[r] > out.max_recovery_s[r]) out.max_recovery_s[r] = episode_s[r];
+            } else {
+                episode_s[r] = 0.0;
+            }
+        }
+    }
+
+    out.flights++;
+    if (min_altitude < out.min_altitude) out.min_altitude = min_altitude;
+    out.sum_min_altitude += min_altitude;
+    int bucket = min_altitude <= 0.0f ? 0 : std::min(5, 1 + (int) (min_altitude / 500.0f));
+    out.min_altitude_buckets[bucket]++;
+    if (longest_bank_s > out.max_bank_s) out.max_bank_s = longest_bank_s;
+
+    bool bank_violation = longest_bank_s > cfg.bank_limit_s;
+    if (ground) out.ground_contacts++;
+    if (bank_violation) out.bank_violations++;
+    if (ground || bank_violation) out.report_bad(index);
+}
+
+// Un volo solo, quello con l'indice stampato dalla campagna: stesso seed e stessi parametri lo rifanno uguale
+int fly_one(long index, const CampaignConfig& cfg) {
+    CampaignStats s;
+    fly(index, cfg, s);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "--- Volo " << index << " (seed " << cfg.seed << ", " << cfg.duration_s << " s a " << cfg.rate_hz << " Hz) ---\n";
+    std::cout << "Quota minima: " << s.min_altitude << " m" << (s.ground_contacts > 0 ? " | CONTATTO COL SUOLO" : "") << "\n";
+    std::cout << "Rollio oltre soglia piu' lungo: " << s.max_bank_s << " s"
+              << (s.bank_violations > 0 ? " | VIOLAZIONE" : "") << "\n";
+    for (int r = 0; r < NUM_RECOVERY; r++) {
+        std::cout << "Recovery " << std::left << std::setw(5) << recovery_names[r] << std::right
+                  << " episodi: " << std::setw(4) << s.episodes[r] << " | max: " << std::setw(7) << s.max_recovery_s[r] << " s\n";
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+
+    // USO: ./FlightCampaign [voli] [durata_s] [thread] [rate_hz] [seed] [indice]
+    // con indice rifà e stampa solo quel volo (voli e thread non contano)
+    CampaignConfig cfg;
+    if (argc > 1) cfg.flights = std::stol(argv[1]);
+    if (argc > 2) cfg.duration_s = std::stod(argv[2]);
+    if (argc > 3) cfg.threads = (unsigned) std::stoul(argv[3]);
+    if (argc > 4) cfg.rate_hz = std::stoi(argv[4]);
+    if (argc > 5) cfg.seed = std::stoul(argv[5]);
+    if (argc > 6) return fly_one(std::stol(argv[6]), cfg);
+    if (cfg.threads == 0) cfg.threads = std::thread::hardware_concurrency();
+
+    WorkStealingPool pool(cfg.threads);
+    std::vector<CampaignStats> stats(pool.size());
+
+    for (long first = 0; first < cfg.flights; first += FLIGHTS_PER_JOB) {
+        long last = std::min(cfg.flights, first + FLIGHTS_PER_JOB);
+        pool.submit([first, last, &cfg, &stats](unsigned worker) {
+            for (long f = first; f < last; f++) fly(f, cfg, stats[worker]);
+        });
+    }
+
+    std::cout << "--- Campagna Monte Carlo: " << cfg.flights << " voli da " << cfg.duration_s << " s a "
+              << cfg.rate_hz << " Hz su " << pool.size() << " thread (seed " << cfg.seed << ") ---\n";
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pool.run();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall_s = timespec_diff_ns(start, end) / 1e9;
+
+    CampaignStats total;
+    for (const CampaignStats& s : stats) total.merge(s);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n====================================================\n";
+    std::cout << "           RISULTATI CAMPAGNA INVILUPPO              \n";
+    std::cout << "====================================================\n";
+    std::cout << "Voli: " << total.flights << " | contatti col suolo: " << total.ground_contacts
+              << " | rollio > " << BANK_LIMIT_RAD << " rad a cloche rilasciata per piu' di " << cfg.bank_limit_s << " s: " << total.bank_violations << "\n";
+    std::cout << "Quota minima: assoluta " << total.min_altitude << " m | media " << total.sum_min_altitude / total.flights << " m\n";
+    std::cout << "Quota minima per volo: 0 m: " << total.min_altitude_buckets[0]
+              << " | <500: " << total.min_altitude_buckets[1] << " | <1000: " << total.min_altitude_buckets[2]
+              << " | <1500: " << total.min_altitude_buckets[3] << " | <2000: " << total.min_altitude_buckets[4]
+              << " | oltre: " << total.min_altitude_buckets[5] << "\n";
+    std::cout << "Rollio oltre soglia piu' lungo: " << total.max_bank_s << " s\n";
+    for (int r = 0; r < NUM_RECOVERY; r++) {
+        double avg = total.episodes[r] > 0 ? total.recovery_s[r] / total.episodes[r] : 0.0;
+        std::cout << "Recovery " << std::left << std::setw(5) << recovery_names[r] << std::right
+                  << " episodi: " << std::setw(8) << total.episodes[r]
+                  << " | durata media: " << std::setw(7) << avg << " s | max: " << std::setw(7) << total.max_recovery_s[r] << " s\n";
+    }
+    if (!total.bad_flights.empty()) {
+        std::cout << "Voli con violazioni (primi indici, rifarli con seed " << cfg.seed << " e [indice]):";
+        for (long f : total.bad_flights) std::cout << " " << f;
+        std::cout << "\n";
+    }
+
+    std::cout << "----------------------------------------------------\n";
+    std::cout << "Tempo: " << wall_s << " s | " << total.flights / wall_s << " voli/s | "
+              << total.flights / wall_s / pool.size() << " voli/s per core\n";
+    for (unsigned w = 0; w < pool.size(); w++) {
+        std::cout << "  worker " << std::setw(2) << w << ": " << std::setw(7) << stats[w].flights << " voli ("
+                  << std::setw(9) << stats[w].flights / wall_s << " voli/s) | lavori rubati: " << pool.stolen(w) << "\n";
+    }
+    std::cout << "====================================================\n\n";
+    return 0;
+}
@@ -0,0 +1,312 @@
+//parte DDS del computer di volo usata sia da FlightSim (thread interno) sia da FlightComputer (processo separato)
+#ifndef FLIGHT_COMPUTER_HPP
+#define FLIGHT_COMPUTER_HPP
+
+#include "SharedMemory.hpp"
+#include "TelemetryPubSubTypes.hpp"
+#include "TelemetryBatch.hpp"
+#include "TelemetryDecimation.hpp"
+#include "TelemetryLoan.hpp"
+#include "TelemetryVersion.hpp"
+#include "TransportProfile.hpp"
+#include "StatisticsLevel.hpp"
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// Codice di stato per il frame, la v1 ne pubblica il testo e la v2 il codice
+inline FlightStatus telemetry_status_code(const FlightControls& state) {
+    // Logica autopilota
+    if (state.autopilot_engaged) {
+    	// Usiamo questo flag per indicare RECOVERY
+        if (state.altitude < 1000.0f) return FlightStatus::ALARM_TERRAIN_PULL_UP;
+
+        else if (state.altitude > 12000.0f) return FlightStatus::ALARM_HIGH_ALTITUDE;
+
+        else return FlightStatus::AUTOPILOT_RECOVERY;
+    }
+    else if (std::abs(state.aileron) > 1.2f) return FlightStatus::WARN_HIGH_BANK;
+
+    else return FlightStatus::NOMINAL_FLIGHT;
+}
+
+inline const char* telemetry_status(const FlightControls& state) {
+    return status_text(telemetry_status_code(state));
+}
+
+// Tempo in us dalla write() del pilota sul bus alla pubblicazione del campione: è la "Risposta" della dashboard.
+// Il timestamp lo mette il bus con steady_clock (CLOCK_MONOTONIC, vale anche fra processi), 0 se il frame non ce l'ha
+inline float publish_latency_us(const FlightControls& state) {
+    if (state.timestamp.time_since_epoch().count() == 0) return 0.0f;
+    float us = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - state.timestamp).count();
+    return us > 0.0f ? us : 0.0f;
+}
+
+// Trasforma il frame del pilota nel campione di telemetria e decide il messaggio di stato
+inline void fill_system_stats(const FlightControls& state, SystemStats& stats) {
+    // prendo dalla strucin telemtry idl che nel monitor node usero per la stampa
+    stats.packet_id(state.packet_id);
+    stats.roll(state.aileron);
+    stats.pitch(state.elevator);
+    stats.yaw(state.rudder);
+    stats.altitude(state.altitude);
+    stats.speed(state.speed);//aggiunto a posteriori ho dovuto aggiornare file con .idl
+    stats.latency_us(publish_latency_us(state));
+    stats.status_msg(telemetry_status(state));
+}
+
+// Stessi campi nel campione prestato dal writer: la memoria non è inizializzata, scrivo tutto
+inline void fill_system_stats_plain(const FlightControls& state, SystemStatsPlain& stats) {
+    stats.packet_id(state.packet_id);
+    stats.roll(state.aileron);
+    stats.pitch(state.elevator);
+    stats.yaw(state.rudder);
+    stats.altitude(state.altitude);
+    stats.latency_us(publish_latency_us(state));
+    stats.speed(state.speed);
+    stats.deadline_missed(false);
+    set_status_msg(stats, telemetry_status(state));
+}
+
+// v2: niente stringa, stato come codice e flag a bit. Serve anche al campione prestato, quindi scrivo tutti i campi
+inline void fill_system_stats_v2(const FlightControls& state, SystemStatsV2& stats) {
+    stats.packet_id(state.packet_id);
+    stats.roll(state.aileron);
+    stats.pitch(state.elevator);
+    stats.yaw(state.rudder);
+    stats.altitude(state.altitude);
+    stats.speed(state.speed);
+    stats.status(telemetry_status_code(state));
+    stats.latency_us(latency_us_v2(publish_latency_us(state)));
+    stats.flags((state.autopilot_engaged ? FLAG_AUTOPILOT : 0) | (state.recovery_bank ? FLAG_RECOVERY_BANK : 0));
+}
+
+// Flotta: la v2 con l'id dell'aereo come chiave
+inline void fill_aircraft_telemetry(const FlightControls& state, uint32_t aircraft_id, AircraftTelemetry& stats) {
+    stats.aircraft_id(aircraft_id);
+    stats.packet_id(state.packet_id);
+    stats.roll(state.aileron);
+    stats.pitch(state.elevator);
+    stats.yaw(state.rudder);
+    stats.altitude(state.altitude);
+    stats.speed(state.speed);
+    stats.status(telemetry_status_code(state));
+    stats.latency_us(latency_us_v2(publish_latency_us(state)));
+    stats.flags((state.autopilot_engaged ? FLAG_AUTOPILOT : 0) | (state.recovery_bank ? FLAG_RECOVERY_BANK : 0));
+}
+
+// Copia zero: il campione vive già nella memoria del writer, write() lo pubblica senza serializzarlo
+template <typename Sample>
+inline bool write_telemetry_loaned(eprosima::fastdds::dds::DataWriter* writer, const FlightControls& state,
+                                   void (*fill)(const FlightControls&, Sample&)) {
+    using namespace eprosima::fastdds::dds;
+    void* sample = nullptr;
+    if (writer->loan_sample(sample) != RETCODE_OK) return false; // tutti i campioni ancora in mano ai lettori
+    fill(state, *static_cast<Sample*>(sample));
+    if (writer->write(sample) != RETCODE_OK) {
+        writer->discard_loan(sample);
+        return false;
+    }
+    return true;
+}
+
+// Crea il participant con i trasporti del profilo e le statistiche del livello scelto,
+// restituisce nullptr se qualcosa non va
+inline eprosima::fastdds::dds::DomainParticipant* create_telemetry_participant(const std::string& participant_name,
+        TransportProfile transport = TransportProfile::DEFAULT, StatisticsLevel statistics = StatisticsLevel::OFF) {
+    using namespace eprosima::fastdds::dds;
+
+	DomainParticipantQos pqos;
+	    pqos.name(participant_name);
+	    setup_transport(pqos, transport);
+	    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
+	    if (participant == nullptr) return nullptr;
+
+	    // statistiche: con off nessun DataWriter, con basic solo i contatori, con full anche le latenze
+	    set_statistics_level(participant, StatisticsLevel::OFF, statistics);
+
+    // i monitor decimati (MonitorApp [versione] [max_hz]) vengono filtrati qui, prima di spedire
+    register_decimation_filter(participant);
+    return participant;
+}
+
+// Registra il tipo, crea topic e DataWriter RELIABLE (con data_sharing il tipo deve essere plain)
+// restituisce nullptr se qualcosa non va
+inline eprosima::fastdds::dds::DataWriter* create_telemetry_writer(eprosima::fastdds::dds::DomainParticipant* participant,
+                                                                   eprosima::fastdds::dds::TopicDataType* data_type,
+                                                                   const char* topic_name, bool data_sharing) {
+    using namespace eprosima::fastdds::dds;
+
+    TypeSupport type(data_type);
+    type.register_type(participant);
+
+    Publisher* pub = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    Topic* topic = participant->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    if (pub == nullptr || topic == nullptr) return nullptr;
+
+
+
+    //DATAWRITER
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;//data writer quality of service
+
+    //setto a reliable
+    wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    //cerco di stampare gli heartbeat ogni 100 ms
+    wqos.reliable_writer_qos().times.heartbeat_period.seconds = 0;
+    wqos.reliable_writer_qos().times.heartbeat_period.seconds =0.100; // 100ms
+    if (data_sharing) enable_data_sharing(wqos);
+
+    return pub->create_datawriter(topic, wqos);
+}
+
+// Telemetria del computer di volo nelle versioni richieste: v1 su TelemetryTopic (o SystemStatsPlain su
+// TelemetryPlainTopic con FLIGHT_TELEMETRY=LOAN), v2 su TelemetryV2Topic. In AUTO ci sono tutti e due i writer
+// e ogni versione si pubblica solo se ha almeno un lettore, contato con on_publication_matched.
+// Con batch_samples > 1 la v2 va a pacchetti su TelemetryBatchTopic (sempre con copia, la sequence non è plain).
+// FLEET usa il posto della v2: AircraftTelemetry su TelemetryFleetTopic, con copia e senza batch. L'istanza
+// dell'aereo si registra una volta in init() e ogni write passa il suo handle, senza ricalcolare la chiave
+class TelemetryPublisher : public eprosima::fastdds::dds::DataWriterListener {
+    eprosima::fastdds::dds::DomainParticipant* participant = nullptr;
+    eprosima::fastdds::dds::DataWriter* writer_v1 = nullptr;
+    eprosima::fastdds::dds::DataWriter* writer_v2 = nullptr;
+    TelemetryVersion version = TelemetryVersion::V1;
+    std::atomic<int> readers_v1{0};
+    std::atomic<int> readers_v2{0};
+    SystemStats stats;       // percorso con copia
+    SystemStatsV2 stats_v2;
+    AircraftTelemetry stats_fleet;
+    eprosima::fastdds::rtps::InstanceHandle_t fleet_instance;
+    uint32_t aircraft_id = 1;
+    bool aircraft_id_valid = aircraft_id_from_env(aircraft_id); // false: FBW_AIRCRAFT_ID non è un id, init() rifiuta fleet
+    TelemetryBatcher batcher;
+    TransportProfile transport = transport_profile_from_env();
+    StatisticsLevel statistics = statistics_level_from_env();
+
+public:
+    // prima di init(), altrimenti valgono FBW_TRANSPORT, FBW_STATISTICS e FBW_AIRCRAFT_ID
+    void set_transport(TransportProfile p) { transport = p; }
+    void set_statistics(StatisticsLevel level) { statistics = level; }
+    void set_aircraft_id(uint32_t id) {
+        aircraft_id = id;
+        aircraft_id_valid = true;
+    }
+
+    bool init(const std::string& participant_name, TelemetryVersion v, size_t batch_samples = 1,
+              int batch_window_ms = TELEMETRY_BATCH_WINDOW_MS) {
+        using namespace eprosima::fastdds::dds;
+        version = v;
+        if (version == TelemetryVersion::FLEET && !aircraft_id_valid) {
+            std::cerr << AIRCRAFT_ID_ENV << " non valido: " << std::getenv(AIRCRAFT_ID_ENV) << " (intero da 0 a 4294967295)\n";
+            return false;
+        }
+        batcher.configure(batch_samples, batch_window_ms);
+        participant = create_telemetry_participant(participant_name, transport, statistics);
+        if (participant == nullptr) return false;
+
+        if (version == TelemetryVersion::FLEET) {
+            writer_v2 = create_telemetry_writer(participant, new AircraftTelemetryPubSubType(), TELEMETRY_FLEET_TOPIC, false);
+            if (writer_v2 == nullptr) return false;
+            stats_fleet.aircraft_id(aircraft_id);
+            fleet_instance = writer_v2->register_instance(&stats_fleet);
+        } else if (version != TelemetryVersion::V2) {
+            TopicDataType* type = TELEMETRY_LOAN ? static_cast<TopicDataType*>(new SystemStatsPlainPubSubType())
+                                                 : new SystemStatsPubSubType();
+            writer_v1 = create_telemetry_writer(participant, type, TELEMETRY_LOAN ? TELEMETRY_PLAIN_TOPIC : TELEMETRY_TOPIC,
+                                                TELEMETRY_LOAN && transport_allows_data_sharing(transport));
+            if (writer_v1 == nullptr) return false;
+        }
+        if (version == TelemetryVersion::V1 || version == TelemetryVersion::FLEET) {
+            // nessun writer v2
+        } else if (batching()) {
+            writer_v2 = create_telemetry_writer(participant, new SystemStatsBatchPubSubType(), TELEMETRY_BATCH_TOPIC, false);
+            if (writer_v2 == nullptr) return false;
+        } else {
+            writer_v2 = create_telemetry_writer(participant, new SystemStatsV2PubSubType(), TELEMETRY_V2_TOPIC,
+                                                TELEMETRY_LOAN && transport_allows_data_sharing(transport));
+            if (writer_v2 == nullptr) return false;
+        }
+
+        // il listener si attacca dopo aver salvato i puntatori, poi riprendo i lettori già scoperti
+        PublicationMatchedStatus matched;
+        for (DataWriter* w : { writer_v1, writer_v2 }) {
+            if (w == nullptr) continue;
+            w->set_listener(this);
+            w->get_publication_matched_status(matched);
+            (w == writer_v2 ? readers_v2 : readers_v1).store(matched.current_count);
+        }
+        return true;
+    }
+
+    void on_publication_matched(eprosima::fastdds::dds::DataWriter* writer,
+                                const eprosima::fastdds::dds::PublicationMatchedStatus& info) override {
+        (writer == writer_v2 ? readers_v2 : readers_v1).store(info.current_count);
+        std::cout << "[DDS] lettori telemetria " << (writer == writer_v2 ? (version == TelemetryVersion::FLEET ? "fleet" : "v2") : "v1") << ": " << info.current_count << std::endl;
+    }
+
+    bool batching() const { return version != TelemetryVersion::FLEET && batcher.capacity() > 1; }
+
+    // con V1 o V2 scrive sempre, come prima; in AUTO salta le versioni senza lettori
+    void publish(const FlightControls& state) {
+        bool automatic = version == TelemetryVersion::AUTO;
+        if (writer_v1 != nullptr && (!automatic || readers_v1.load(std::memory_order_relaxed) > 0)) {
+            if (TELEMETRY_LOAN) {
+                write_telemetry_loaned(writer_v1, state, fill_system_stats_plain);
+            } else {
+                fill_system_stats(state, stats);
+                writer_v1->write(&stats);
+            }
+        }
+        if (writer_v2 != nullptr && (!automatic || readers_v2.load(std::memory_order_relaxed) > 0)) {
+            if (version == TelemetryVersion::FLEET) {
+                fill_aircraft_telemetry(state, aircraft_id, stats_fleet);
+                writer_v2->write(&stats_fleet, fleet_instance);
+            } else if (batching()) {
+                fill_system_stats_v2(state, batcher.next());
+                if (batcher.due()) flush();
+            } else if (TELEMETRY_LOAN) {
+                write_telemetry_loaned(writer_v2, state, fill_system_stats_v2);
+            } else {
+                fill_system_stats_v2(state, stats_v2);
+                writer_v2->write(&stats_v2);
+            }
+        }
+    }
+
+    // spedisce il batch in attesa, false se non c'era niente
+    bool flush() {
+        if (writer_v2 == nullptr || batcher.empty()) return false;
+        writer_v2->write(&batcher.pending());
+        batcher.sent();
+        return true;
+    }
+
+    // quanto il thread può dormire sul bus prima che scada la finestra del batch (-1 = senza limite)
+    int flush_timeout_ms() const { return batcher.timeout_ms(); }
+
+    // per StatisticsSwitch, nullptr prima di init() e dopo close()
+    eprosima::fastdds::dds::DomainParticipant* dds_participant() const { return participant; }
+    StatisticsLevel statistics_level() const { return statistics; }
+
+    void close() {
+        if (participant == nullptr) return;
+        flush();
+        participant->delete_contained_entities();
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->delete_participant(participant);
+        participant = nullptr;
+        writer_v1 = writer_v2 = nullptr;
+    }
+
+    ~TelemetryPublisher() { close(); }
+};
+
+#endif
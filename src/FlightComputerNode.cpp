@@ -0,0 +1,98 @@
+//computer di volo come processo separato: legge i FlightControls dal segmento POSIX scritto da FlightSim
+//(compilato con -DFLIGHT_BUS=POSIX_SHM) e pubblica la telemetria su DDS. Così il loop pilota e la parte DDS
+//hanno spazi di indirizzamento diversi e possono stare su core isolati diversi
+#include "ProcessSharedBus.hpp"
+#include "FlightComputer.hpp"
+#include "RtThread.hpp"
+#include <sys/mman.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace eprosima::fastdds::dds;
+
+int main(int argc, char* argv[]) {
+
+    // prima di ogni thread: SIGUSR1 lo prende solo il thread di StatisticsSwitch
+    StatisticsSwitch::block_signal();
+
+    // USO: ./FlightComputer [core] [priorita_fifo] [v1|v2|fleet|auto] [batch] [finestra_batch_ms]
+    //      trasporto DDS con FBW_TRANSPORT=default|shm|udp|intra, statistiche con FBW_STATISTICS=off|basic|full,
+    //      con fleet l'id dell'aereo è FBW_AIRCRAFT_ID (default 1)
+    int core = (argc > 1) ? std::stoi(argv[1]) : -1;
+    int priority = (argc > 2) ? std::stoi(argv[2]) : 0;
+    TelemetryVersion version = TelemetryVersion::AUTO;
+    if (argc > 3 && !parse_telemetry_version(argv[3], version)) {
+        std::cerr << "Versione telemetria sconosciuta: " << argv[3] << " (v1, v2, fleet o auto)\n";
+        return 1;
+    }
+    int batch_samples = (argc > 4) ? std::stoi(argv[4]) : 1;
+    int batch_window_ms = (argc > 5) ? std::stoi(argv[5]) : TELEMETRY_BATCH_WINDOW_MS;
+    if (batch_samples < 1 || batch_samples > (int) TELEMETRY_BATCH_MAX) {
+        std::cerr << "Batch da 1 a " << TELEMETRY_BATCH_MAX << " campioni, non " << batch_samples << "\n";
+        return 1;
+    }
+    if (batch_window_ms < 0) {
+        std::cerr << "Finestra del batch negativa: " << batch_window_ms << "\n";
+        return 1;
+    }
+
+    mlockall(MCL_CURRENT | MCL_FUTURE);
+    pin_current_thread(core, priority);
+
+    TelemetryPublisher telemetry;
+    if (!telemetry.init("Flight_Computer_F35", version, batch_samples, batch_window_ms)) {
+        std::cerr << "Errore DDS Writer\n";
+        return 1;
+    }
+    StatisticsSwitch statistics_switch; // kill -USR1 <pid>: statistiche full e ritorno
+    statistics_switch.start(telemetry.dds_participant(), telemetry.statistics_level());
+
+    // FlightSim crea il segmento, se non è ancora partito (o c'è solo quello di un FlightSim morto) riprovo
+    std::unique_ptr<ProcessSharedBus> bus;
+    auto attach_bus = [&bus]() {
+        std::cout << "[SHM] In attesa del segmento " << FBW_SHM_NAME << " creato da FlightSim..." << std::endl;
+        while (true) {
+            bus.reset(new ProcessSharedBus(FBW_SHM_NAME, false));
+            if (bus->is_open()) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+    };
+    attach_bus();
+    std::cout << "[DDS] Computer di bordo avviato (processo separato, telemetria " << telemetry_version_name(version)
+              << (TELEMETRY_LOAN ? " in prestito" : " con copia")
+              << (telemetry.batching() ? ", v2 a pacchetti" : "") << ", trasporto "
+              << transport_profile_name(transport_profile_from_env())
+              << ", statistiche " << statistics_level_name(statistics_level_from_env()) << "). In attesa dati..." << std::endl;
+
+    FlightControls state;
+    long count = 0;
+
+    // dorme finché non arriva un frame, esce quando FlightSim chiude il bus
+    // (con il batch si sveglia anche quando scade la finestra, spedisce e torna a dormire).
+    // Al più ogni BUS_CHECK_MS controlla che FlightSim non sia morto o ripartito su un segmento nuovo
+    constexpr int BUS_CHECK_MS = 1000;
+    while (true) {
+        int timeout_ms = telemetry.flush_timeout_ms();
+        if (timeout_ms < 0 || timeout_ms > BUS_CHECK_MS) timeout_ms = BUS_CHECK_MS;
+        if (!bus->read_with_timeout(state, timeout_ms)) {
+            if (telemetry.flush()) continue;
+            if (bus->writer_closed()) break;
+            if (bus->replaced()) {
+                std::cout << "[SHM] FlightSim terminato o ripartito, riapro il segmento" << std::endl;
+                attach_bus();
+            }
+            continue;
+        }
+        telemetry.publish(state);
+        count++;
+    }
+
+    std::cout << "[DDS] Pilota chiuso, campioni pubblicati: " << count << std::endl;
+    bus->latency().print(bus->name);
+
+    statistics_switch.shutdown();
+    telemetry.close();
+    return 0;
+}
@@ -62,16 +62,17 @@ bool FlightDisplay::IsActive() { return !WindowShouldClose(); }
 // ========================================================
 // LETTURA COMANDI (Aggiunti Tasti L e C)
 // ========================================================
-void FlightDisplay::HandleInput(PlaneData& data) {
+// Legge solo la tastiera: la fisica la fa apply_pilot_input, così può girare anche in un altro thread
+PilotInput FlightDisplay::ReadInput() {
 
-    bool isPitching = false;
-    bool isRolling = false;
+    PilotInput in;
 
     // --- TOGGLE CARRELLO E ATTERRAGGIO (TASTO L) ---
     if (IsKeyPressed(KEY_L)) {
-        data.landing_mode = !data.landing_mode;
-        gearOpen = data.landing_mode; // Apriamo/Chiudiamo anche i carrelli visivi!
+        landingMode = !landingMode;
+        gearOpen = landingMode; // Apriamo/Chiudiamo anche i carrelli visivi!
     }
+    in.landing_mode = landingMode;
 
     // --- TOGGLE TELECAMERE (TASTO C) ---
     if (IsKeyPressed(KEY_C)) {
@@ -79,53 +80,22 @@ void FlightDisplay::HandleInput(PlaneData& data) {
     }
 
     // 1. LETTURA CLOCHE
-    if (IsKeyDown(KEY_UP)) {
-        data.pitch += 0.03f;
-        isPitching = true;
-    }
-    if (IsKeyDown(KEY_DOWN)) {
-        data.pitch -= 0.03f;
-        isPitching = true;
-    }
-    if (IsKeyDown(KEY_LEFT)) {
-        data.roll -= 0.025f;
-        isRolling = true;
-    }
-    if (IsKeyDown(KEY_RIGHT)) {
-        data.roll += 0.025f;
-        isRolling = true;
-    }
+    in.pitch_up = IsKeyDown(KEY_UP);
+    in.pitch_down = IsKeyDown(KEY_DOWN);
+    in.roll_left = IsKeyDown(KEY_LEFT);
+    in.roll_right = IsKeyDown(KEY_RIGHT);
 
     // 2. LETTURA TIMONE
-    if (IsKeyDown(KEY_Q)) data.yaw += 0.01f;
-    if (IsKeyDown(KEY_E)) data.yaw -= 0.01f;
-
-    // Raddrizzamento naturale morbido
-    if (!isRolling) {
-        data.roll = Lerp(data.roll, 0.0f, 0.015f);
-    }
-    if (!isPitching) {
-        data.pitch = Lerp(data.pitch, 0.0f, 0.005f);
-    }
+    in.yaw_left = IsKeyDown(KEY_Q);
+    in.yaw_right = IsKeyDown(KEY_E);
 
     // 3. GESTIONE MOTORE
-    if (IsKeyDown(KEY_SPACE)) {
-        data.speed = 0.0f;
-    } else {
-        if (IsKeyDown(KEY_W)) {
-            data.speed += 0.8f;
-        } else if (IsKeyDown(KEY_S)) {
-            data.speed -= 1.2f;
-        } else {
-            if (data.speed > 0) data.speed -= 0.15f;
-        }
-    }
-
-    // Limiti velocità (Se in atterraggio, limite raccomandato visivamente ma meccanica max a 200)
-    if (data.speed > 200.0f) data.speed = 200.0f;
-    if (data.speed < 0.0f) data.speed = 0.0f;
+    in.engine_cut = IsKeyDown(KEY_SPACE);
+    in.throttle_up = IsKeyDown(KEY_W);
+    in.throttle_down = IsKeyDown(KEY_S);
 
     UpdateAnimations();
+    return in;
 }
 
 // ========================================================
@@ -3,22 +3,8 @@
 #include "raylib.h"
 #include <string>
 #include <vector>
-
-// Struttura Dati Aereo con cui passo alla grafic ai dati
-struct PlaneData {
-    float roll = 0.0f;
-    float pitch = 0.0f;
-    float yaw = 0.0f;
-    float altitude = 5000.0f;
-   //movimento nello spazio nelle tre dimensioni
-    float x = 0.0f;
-    float z = 0.0f;
-float speed=0.0f;
-char status_msg[64];//aggiunto per gestire nel monitor i messaggi di condizione di volo
-    bool system_active = true;
-    bool landing_mode = false;//per diabilitare il fly-by-wire
-};
-
+#include "PlaneData.hpp"
+#include "FlightPhysics.hpp"
 
 class FlightDisplay {
 
@@ -28,6 +14,7 @@ private:
 	    int animsCount=0;
 	    float gearFrame=0.0f;    // DEVE essere float
 	    bool gearOpen=false;
+	    bool landingMode=false; // stato del tasto L, lo porta ReadInput dentro PilotInput
 //devo implementare su blender
     // Variabili per i FLAP/ALETTONI
     int flapFrame = 0;
@@ -38,7 +25,7 @@ public:
     ~FlightDisplay(); // Distruttore (Importante per scaricare il modello)
 
     bool IsActive();
-    void HandleInput(PlaneData& data);
+    PilotInput ReadInput();
     void Draw(const PlaneData& data);
 
 private:
@@ -0,0 +1,210 @@
+//fisica e fly-by-wire dell'aereo senza raylib: le usa il thread real-time di FlightSim
+//(e chiunque voglia far volare l'aereo senza finestra)
+#ifndef FLIGHT_PHYSICS_HPP
+#define FLIGHT_PHYSICS_HPP
+
+#include "PlaneData.hpp"
+#include <cmath>
+
+// Tutte le costanti della fisica sono state tarate per un passo a 60 Hz (un passo per frame del vecchio loop)
+constexpr float NOMINAL_RATE_HZ = 60.0f;
+
+// Comandi del pilota letti dalla tastiera, separati dalla fisica così si possono passare a un altro thread
+struct PilotInput {
+    bool pitch_up = false;
+    bool pitch_down = false;
+    bool roll_left = false;
+    bool roll_right = false;
+    bool yaw_left = false;
+    bool yaw_right = false;
+    bool throttle_up = false;
+    bool throttle_down = false;
+    bool engine_cut = false;
+    bool landing_mode = false; // stato del tasto L (già commutato), non il singolo tasto premuto
+};
+
+// Stato dell'autopilota di recupero, resta vivo tra un passo e l'altro
+struct FbwState {
+    bool recovery_low = false;
+    bool recovery_high = false;
+    bool recovery_bank = false;
+    bool recovery_zero = false;
+
+    bool autopilot_engaged() const { return recovery_low || recovery_high; }
+};
+
+// dt_scale = 60 / frequenza del passo: a 60 Hz vale 1 e i conti sono identici a quelli del vecchio loop,
+// a 500 Hz ogni passo fa 0.12 del movimento di prima così l'aereo vola alla stessa velocità
+inline float step_scale(float rate_hz) { return NOMINAL_RATE_HZ / rate_hz; }
+
+// fattore che moltiplica ogni passo (es. roll *= 0.95): per avere lo stesso effetto al secondo va elevato a dt_scale
+inline float step_decay(float factor, float dt_scale) {
+    return dt_scale == 1.0f ? factor : std::pow(factor, dt_scale);
+}
+
+// quota del Lerp verso lo zero fatto a ogni passo, riportata alla frequenza del passo
+inline float step_blend(float amount, float dt_scale) {
+    return dt_scale == 1.0f ? amount : 1.0f - std::pow(1.0f - amount, dt_scale);
+}
+
+// stesso conto di Lerp() di raymath, copiato per non dipendere da raylib
+inline float physics_lerp(float start, float end, float amount) {
+    return start + amount * (end - start);
+}
+
+// 1. COMANDI: cloche, timone e motore (i tasti li legge FlightDisplay::ReadInput)
+inline void apply_pilot_input(PlaneData& data, const PilotInput& in, float dt_scale) {
+
+    bool isPitching = false;
+    bool isRolling = false;
+
+    data.landing_mode = in.landing_mode;
+
+    // LETTURA CLOCHE
+    if (in.pitch_up) {
+        data.pitch += 0.03f * dt_scale;
+        isPitching = true;
+    }
+    if (in.pitch_down) {
+        data.pitch -= 0.03f * dt_scale;
+        isPitching = true;
+    }
+    if (in.roll_left) {
+        data.roll -= 0.025f * dt_scale;
+        isRolling = true;
+    }
+    if (in.roll_right) {
+        data.roll += 0.025f * dt_scale;
+        isRolling = true;
+    }
+
+    // LETTURA TIMONE
+    if (in.yaw_left) data.yaw += 0.01f * dt_scale;
+    if (in.yaw_right) data.yaw -= 0.01f * dt_scale;
+
+    // Raddrizzamento naturale morbido
+    if (!isRolling) {
+        data.roll = physics_lerp(data.roll, 0.0f, step_blend(0.015f, dt_scale));
+    }
+    if (!isPitching) {
+        data.pitch = physics_lerp(data.pitch, 0.0f, step_blend(0.005f, dt_scale));
+    }
+
+    // GESTIONE MOTORE
+    if (in.engine_cut) {
+        data.speed = 0.0f;
+    } else {
+        if (in.throttle_up) {
+            data.speed += 0.8f * dt_scale;
+        } else if (in.throttle_down) {
+            data.speed -= 1.2f * dt_scale;
+        } else {
+            if (data.speed > 0) data.speed -= 0.15f * dt_scale;
+        }
+    }
+
+    // Limiti velocità (Se in atterraggio, limite raccomandato visivamente ma meccanica max a 200)
+    if (data.speed > 200.0f) data.speed = 200.0f;
+    if (data.speed < 0.0f) data.speed = 0.0f;
+}
+
+// 2. FLY-BY-WIRE e integrazione della posizione (prima stava nel while del main)
+inline void fbw_step(PlaneData& Aereo, FbwState& fbw, float dt_scale) {
+
+    // L'autopilota scatta solo se NON stai cercando di atterrare (Aereo.landing_mode == false)
+    if (Aereo.altitude < 2000.0f && Aereo.speed >= 0.0f && !Aereo.landing_mode) {
+        fbw.recovery_low = true;
+    } else if (Aereo.landing_mode) {
+        // Disattiva attivamente il recupero se attiviamo il Landing Mode mentre sta già correggendo
+        fbw.recovery_low = false;
+    }
+    // Rischio caduta a motori spenti
+    if (Aereo.speed < 10.0f && Aereo.altitude <= 2500.0f) fbw.recovery_zero = true;
+
+    // Rischio stratosfera / stallo (Sopra i 13000m)
+    if (Aereo.altitude > 13000.0f) fbw.recovery_high = true;
+
+    // Inclinazione critica (Superiore a 1.2 radianti, come nell'HUD)
+    if (std::abs(Aereo.roll) > 1.2f) fbw.recovery_bank = true;
+
+
+    if (fbw.recovery_low) {
+        Aereo.roll *= step_decay(0.95f, dt_scale); // Raddrizza le ali
+        if (Aereo.pitch < 0.3f) Aereo.pitch += 0.005f * dt_scale; // Tira su il muso dolcemente
+        if (Aereo.speed < 150.0f) Aereo.speed += 0.5f * dt_scale; // Dà gas per salire
+
+        // Si spegne quando raggiungi quota di sicurezza (2500m)
+        if (Aereo.altitude >= 2500.0f) fbw.recovery_low = false;
+    }
+
+    // Recupero a Motori Spenti (Riaccensione d'emergenza)
+    if (fbw.recovery_zero) {
+        if (Aereo.speed < 100.0f) Aereo.speed += 1.5f * dt_scale; // Booster ai motori
+        if (Aereo.pitch < 0.2f) Aereo.pitch += 0.01f * dt_scale;  // Alza il muso per non cadere a picco
+
+        if (Aereo.altitude >= 2500.0f && Aereo.speed >= 100.0f) fbw.recovery_zero = false;
+    }
+    // Recupero da Alta Quota (OVERSHOOT PULL DOWN)
+    else if (fbw.recovery_high) {
+        Aereo.roll *= step_decay(0.95f, dt_scale); // Raddrizza
+        if (Aereo.pitch > 0.0f) Aereo.pitch -= 0.05f * dt_scale; // Abbassa il muso velocemente se punti in alto
+        else if (Aereo.pitch > -0.2f) Aereo.pitch -= 0.005f * dt_scale; // Lo tiene inclinato verso il basso
+
+        // Si spegne quando torni sotto i 12000m
+        if (Aereo.altitude <= 12000.0f) fbw.recovery_high = false;
+    }
+
+
+    if (fbw.recovery_bank) {
+        // Raddrizza il rollio usando la funzione fluida
+        if (Aereo.roll > 0.15f) Aereo.roll -= 0.015f * dt_scale;
+        else if (Aereo.roll < -0.15f) Aereo.roll += 0.015f * dt_scale;
+        else fbw.recovery_bank = false; // Disinnesca l'autopilota quando sei dritto
+    }
+
+
+    float speed_orizzontale = Aereo.speed * std::cos(Aereo.pitch);
+    float speed_verticale   = Aereo.speed * std::sin(Aereo.pitch);
+
+    // Perdita di portanza se l'aereo è troppo inclinato (Virata stretta)
+    if (std::abs(Aereo.roll) > 0.8f) {
+        speed_verticale -= 1.5f;
+    }
+
+    // Effetto gravità se l'aereo va troppo piano
+    if (Aereo.speed < 50.0f) {
+        speed_verticale -= (50.0f - Aereo.speed) * 0.05f;
+    }
+
+    // Variabile MAGICA per regolare lo spostamento nello spazio senza toccare la velocità
+    float physics_scale = 0.015f * dt_scale;
+
+    Aereo.x += std::sin(Aereo.yaw) * speed_orizzontale * physics_scale;
+    Aereo.z += std::cos(Aereo.yaw) * speed_orizzontale * physics_scale;
+
+    // Altitudine gestita dal moltiplicatore che hai scelto (0.2f o modificalo a piacimento)
+    Aereo.altitude += speed_verticale * 0.2f * dt_scale;
+
+    if (Aereo.altitude < 0) Aereo.altitude = 0.0f; // Pavimento assoluto
+
+    if(Aereo.roll > 3.2f)  Aereo.roll = 3.2f;
+    if(Aereo.roll < -3.2f) Aereo.roll = -3.2f;
+    if(Aereo.pitch > 1.5f) Aereo.pitch = 1.5f;
+    if(Aereo.pitch < -1.5f) Aereo.pitch = -1.5f;
+}
+
+// Stato dell'aereo tra due passi della fisica: il render disegna una posizione intermedia
+// (yaw e roll non fanno il giro di 2*pi nel modello, quindi l'interpolazione lineare va bene)
+inline PlaneData interpolate_plane(const PlaneData& prev, const PlaneData& curr, float alpha) {
+    PlaneData out = curr; // flag e messaggi presi dallo stato più recente
+    out.roll = physics_lerp(prev.roll, curr.roll, alpha);
+    out.pitch = physics_lerp(prev.pitch, curr.pitch, alpha);
+    out.yaw = physics_lerp(prev.yaw, curr.yaw, alpha);
+    out.altitude = physics_lerp(prev.altitude, curr.altitude, alpha);
+    out.x = physics_lerp(prev.x, curr.x, alpha);
+    out.z = physics_lerp(prev.z, curr.z, alpha);
+    out.speed = physics_lerp(prev.speed, curr.speed, alpha);
+    return out;
+}
+
+#endif
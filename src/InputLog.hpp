@@ -0,0 +1,161 @@
+//registrazione dei comandi del pilota passo per passo, insieme a quello che la fisica ha scritto sul bus,
+//per rifare lo stesso volo senza finestra e controllare che lo stato sia identico bit per bit
+//file: InputLogHeader seguito da un InputLogRecord (32 byte) per ogni passo della fisica
+#ifndef INPUT_LOG_HPP
+#define INPUT_LOG_HPP
+
+#include "FlightPhysics.hpp"
+#include "SpscQueue.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+struct InputLogHeader {
+    char magic[4];        // "FBWL"
+    uint32_t version;
+    uint32_t rate_hz;     // frequenza della fisica, serve per rifare lo stesso dt_scale
+    uint32_t record_size;
+};
+
+struct InputLogRecord {
+    uint16_t input;   // un bit per comando, vedi encode_input
+    uint16_t flags;   // bit 0 autopilot_engaged, bit 1 recovery_bank
+    float roll, pitch, yaw, altitude, speed, x, z; // stessi valori passati a bus.write
+};
+static_assert(sizeof(InputLogRecord) == 32, "record del log di 32 byte");
+
+constexpr uint32_t INPUT_LOG_VERSION = 1;
+
+inline uint16_t encode_input(const PilotInput& in) {
+    return (uint16_t) (in.pitch_up << 0 | in.pitch_down << 1 | in.roll_left << 2 | in.roll_right << 3
+                     | in.yaw_left << 4 | in.yaw_right << 5 | in.throttle_up << 6 | in.throttle_down << 7
+                     | in.engine_cut << 8 | in.landing_mode << 9);
+}
+
+inline PilotInput decode_input(uint16_t bits) {
+    PilotInput in;
+    in.pitch_up = bits & (1 << 0);
+    in.pitch_down = bits & (1 << 1);
+    in.roll_left = bits & (1 << 2);
+    in.roll_right = bits & (1 << 3);
+    in.yaw_left = bits & (1 << 4);
+    in.yaw_right = bits & (1 << 5);
+    in.throttle_up = bits & (1 << 6);
+    in.throttle_down = bits & (1 << 7);
+    in.engine_cut = bits & (1 << 8);
+    in.landing_mode = bits & (1 << 9);
+    return in;
+}
+
+inline InputLogRecord make_log_record(const PilotInput& in, const PlaneData& p, const FbwState& fbw) {
+    InputLogRecord r;
+    r.input = encode_input(in);
+    r.flags = (uint16_t) (fbw.autopilot_engaged() << 0 | fbw.recovery_bank << 1);
+    r.roll = p.roll;
+    r.pitch = p.pitch;
+    r.yaw = p.yaw;
+    r.altitude = p.altitude;
+    r.speed = p.speed;
+    r.x = p.x;
+    r.z = p.z;
+    return r;
+}
+
+// Confronto bit a bit (anche -0.0 e NaN devono essere identici)
+inline bool same_record(const InputLogRecord& a, const InputLogRecord& b) {
+    return std::memcmp(&a, &b, sizeof(InputLogRecord)) == 0;
+}
+
+// Il thread della fisica mette i record in una coda senza lock, un thread normale li scrive su file:
+// nessuna scrittura su disco dentro il passo real-time
+class InputRecorder {
+    static constexpr size_t QUEUE_SIZE = 8192; // 16 s a 500 Hz prima di perdere record
+
+    SpscQueue<InputLogRecord, QUEUE_SIZE> queue;
+    FILE* file = nullptr;
+    std::thread writer;
+    std::atomic<bool> stop{false};
+    std::atomic<long> dropped{0};
+    long written = 0;
+    bool lossless = false;
+
+    void writer_loop() {
+        InputLogRecord batch[512];
+        while (true) {
+            bool last = stop.load(std::memory_order_acquire); // letto prima di svuotare: dopo lo stop non arriva più niente
+            size_t n;
+            while ((n = queue.pop_batch(batch, 512)) > 0) {
+                written += (long) std::fwrite(batch, sizeof(InputLogRecord), n, file);
+            }
+            if (last) break;
+            usleep(5000);
+        }
+    }
+
+public:
+    // wait_when_full = true aspetta il writer invece di perdere record: solo senza thread real-time (headless)
+    bool open(const std::string& path, int rate_hz, bool wait_when_full = false) {
+        lossless = wait_when_full;
+        file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            std::perror("registrazione comandi");
+            return false;
+        }
+        InputLogHeader h;
+        std::memcpy(h.magic, "FBWL", 4);
+        h.version = INPUT_LOG_VERSION;
+        h.rate_hz = (uint32_t) rate_hz;
+        h.record_size = sizeof(InputLogRecord);
+        std::fwrite(&h, sizeof(h), 1, file);
+        writer = std::thread(&InputRecorder::writer_loop, this);
+        return true;
+    }
+
+    // chiamata dal thread della fisica a ogni passo, non si blocca mai (tranne in modalità lossless)
+    void record(const PilotInput& in, const PlaneData& p, const FbwState& fbw) {
+        InputLogRecord r = make_log_record(in, p, fbw);
+        if (lossless) {
+            while (!queue.try_push(r)) std::this_thread::yield();
+        } else if (!queue.try_push(r)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void close() {
+        if (file == nullptr) return;
+        stop.store(true, std::memory_order_release);
+        writer.join();
+        std::fclose(file);
+        file = nullptr;
+        std::printf("[REC] passi registrati: %ld | persi (coda piena): %ld%s\n", written, dropped.load(),
+                    dropped.load() > 0 ? " -> il log non si puo' rifare bit per bit" : "");
+    }
+
+    ~InputRecorder() { close(); }
+};
+
+// Legge tutto il log in memoria, restituisce false se il file non è un log valido
+inline bool load_input_log(const std::string& path, InputLogHeader& header, std::vector<InputLogRecord>& records) {
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        std::perror("log comandi");
+        return false;
+    }
+    bool ok = std::fread(&header, sizeof(header), 1, f) == 1 && std::memcmp(header.magic, "FBWL", 4) == 0
+              && header.version == INPUT_LOG_VERSION && header.record_size == sizeof(InputLogRecord) && header.rate_hz > 0;
+    if (ok) {
+        InputLogRecord r;
+        while (std::fread(&r, sizeof(r), 1, f) == 1) records.push_back(r);
+    } else {
+        std::fprintf(stderr, "%s non e' un log di comandi valido\n", path.c_str());
+    }
+    std::fclose(f);
+    return ok;
+}
+
+#endif
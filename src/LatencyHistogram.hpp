@@ -0,0 +1,89 @@
+//istogramma di latenza a bucket logaritmici (stile HDR): memoria fissa, record() O(1) e senza allocazioni,
+//percentili con errore relativo sotto il 6.25%. RollingLatency ne tiene uno per tutto il run e uno per la
+//finestra in corso, con l'ultima finestra chiusa sempre disponibile.
+//Lo usano StatsCollector, la dashboard di MonitorApp e i test real-time in rt_tests
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// 16 bucket per ottava sui nanosecondi, esatto sotto i 16 ns, fino a 2^43 ns (oltre va nell'ultimo bucket).
+// Circa 2.5 kB: va bene per variabili globali, membri e stack dei thread, non per migliaia di istanze
+struct LatencyHistogram {
+    static constexpr int SUB = 16;
+    static constexpr int BUCKETS = 40 * SUB;
+    uint32_t counts[BUCKETS] = {};
+    uint64_t total = 0;
+    uint64_t max_ns = 0;
+    double sum_ns = 0.0;
+
+    static int bucket(uint64_t ns) {
+        if (ns < (uint64_t) SUB) return (int) ns;
+        int msb = 63 - __builtin_clzll(ns);
+        int b = (msb - 3) * SUB + (int) ((ns >> (msb - 4)) - SUB);
+        return b < BUCKETS ? b : BUCKETS - 1;
+    }
+
+    // valore più alto che finisce nel bucket b
+    static uint64_t bucket_upper(int b) {
+        if (b < SUB) return (uint64_t) b;
+        int shift = b / SUB - 1;
+        uint64_t lower = (uint64_t) (SUB + b % SUB) << shift;
+        return lower + ((1ULL << shift) - 1);
+    }
+
+    void reset() { std::memset(this, 0, sizeof(*this)); }
+
+    void record(uint64_t ns) {
+        counts[bucket(ns)]++;
+        total++;
+        sum_ns += (double) ns;
+        if (ns > max_ns) max_ns = ns;
+    }
+
+    uint64_t percentile(double p) const {
+        if (total == 0) return 0;
+        uint64_t rank = (uint64_t) std::ceil(p / 100.0 * (double) total);
+        if (rank < 1) rank = 1;
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            seen += counts[b];
+            if (seen >= rank) return bucket_upper(b) < max_ns ? bucket_upper(b) : max_ns;
+        }
+        return max_ns;
+    }
+
+    double mean_ns() const { return total > 0 ? sum_ns / (double) total : 0.0; }
+};
+
+// Run e finestre: record() va in tutti e due, roll() chiude la finestra in corso (chi la chiama decide quando)
+struct RollingLatency {
+    LatencyHistogram run;
+    LatencyHistogram window;      // finestra in corso
+    LatencyHistogram last_window; // ultima finestra chiusa
+
+    void record(uint64_t ns) {
+        run.record(ns);
+        window.record(ns);
+    }
+
+    void roll() {
+        last_window = window;
+        window.reset();
+    }
+
+    // la finestra in corso, o l'ultima chiusa se quella in corso è appena partita ed è ancora vuota
+    const LatencyHistogram& recent() const { return window.total > 0 ? window : last_window; }
+};
+
+// riga con campioni, p50, p90, p99, p99.9 e max in unità di unit_ns nanosecondi (1000 = us, 1000000 = ms)
+inline void print_latency_row(const char* label, const LatencyHistogram& h, double unit_ns, const char* unit) {
+    std::printf("%-22s n=%-8llu p50 %9.3f  p90 %9.3f  p99 %9.3f  p99.9 %9.3f  max %9.3f %s\n", label,
+                (unsigned long long) h.total, h.percentile(50) / unit_ns, h.percentile(90) / unit_ns,
+                h.percentile(99) / unit_ns, h.percentile(99.9) / unit_ns, h.max_ns / unit_ns, unit);
+}
+
+#endif
@@ -1,4 +1,16 @@
 #include "TelemetryPubSubTypes.hpp"
+#include "TelemetryBatch.hpp"
+#include "TelemetryDecimation.hpp"
+#include "TelemetryLoan.hpp"
+#include "TelemetryVersion.hpp"
+#include "TransportProfile.hpp"
+#include "StatisticsLevel.hpp"
+#include "FlatHashMap.hpp"
+#include "SpscQueue.hpp"
+#include "LatencyHistogram.hpp"
+#include "DashboardView.hpp"
+#include "WaitSetReader.hpp"
+#include "SequenceTracker.hpp"
 #include <fastdds/dds/domain/DomainParticipant.hpp>
 #include <fastdds/dds/domain/DomainParticipantFactory.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
@@ -15,13 +27,14 @@
 #include <fastdds/statistics/dds/publisher/qos/DataWriterQos.hpp>
 #include "MonitorDisplay.hpp"
 #include <iostream>
-#include <iomanip>
 #include <thread>
 #include <string>
 #include <vector>
-#include <numeric>
-#include <cmath>
 #include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
 
 using namespace eprosima::fastdds::dds;
 
@@ -30,215 +43,598 @@ PlaneData shared_aereo;
 float shared_jitter,shared_cycle_time;
 std::mutex aereo_mutex;
 
-// Funzione per disegnare barre di caricamento
-std::string Barre_Caricamento(float value, float max, int width, std::string color) {
-    int fill = (int)((value / max) * width);
-    if (fill > width) fill = width;
-    if (fill < 0) fill = 0;
-    
-    std::string bar = "[";
-    bar += color;
-    for (int i = 0; i < width; i++) {
-        if (i < fill) bar += "|";
-        else bar += " ";
-    }
-    bar += "\033[0m]";
-    return bar;
-}
-
-class DashboardListener : public DataReaderListener {
-    // Statistiche Rete
+// Stato della dashboard per un aereo: con v1 e v2 ce n'è uno solo (SINGLE_AIRCRAFT), con fleet uno per aircraft_id
+struct AircraftState {
+    // Statistiche Rete (perse, duplicati e fuori ordine li conta il SequenceTracker di ogni writer)
     long total_packets = 0;
-    long missed_packets = 0;
-    
-    std::chrono::steady_clock::time_point last_pkt_time;
+
+    long last_arrival_ns = 0;          // arrivo dell'ultimo campione mostrato (preso dal listener, non dal display)
     bool first = true;
-    std::vector<float> jitter_history; //vettore che mantiene la storia dei ritardi
-    float max_jitter_seen = 0.0f;      //lo metto a zero in modo che il primo jitter diventi il massimo
+    bool alive = true;                 // false quando nessun writer pubblica più l'aereo (istanza NOT_ALIVE)
+    SequenceTotals retired;            // writer dell'aereo già scollegati: contatori fermi, i buchi aperti sono persi
+    float cycle_time = 0.0f;           // ms fra gli ultimi due arrivi
+    SystemStatsV2 last;                // ultimo campione da mostrare
+};
+
+constexpr uint32_t SINGLE_AIRCRAFT = 0;
+
+// Sequenza dei packet_id di un writer; con la telemetria fleet un writer può pubblicare più aerei, la chiave li separa
+struct WriterSequence {
+    uint32_t aircraft_id = SINGLE_AIRCRAFT;
+    uint32_t publication = 0; // publication_key del writer, per toglierlo quando si scollega
+    SequenceTracker sequence;
+};
+
+// FNV-1a del GUID del writer (publication_handle)
+uint32_t publication_key(const eprosima::fastdds::rtps::InstanceHandle_t& publication) {
+    uint32_t h = 2166136261u;
+    for (uint8_t b : publication.value) h = (h ^ b) * 16777619u;
+    return h;
+}
+
+// chiave del writer per la tabella delle sequenze: il suo publication_key mescolato con l'aereo
+uint32_t writer_key(uint32_t publication, uint32_t aircraft_id) {
+    return publication ^ aircraft_id * 0x9E3779B1u;
+}
+
+// Quello che un listener passa al thread della dashboard: il campione già in v2 e l'istante di arrivo
+struct DashboardEvent {
+    uint32_t aircraft_id = SINGLE_AIRCRAFT;
+    uint32_t publication = 0; // publication_key di chi l'ha pubblicato
+    bool writer_gone = false; // il writer publication si è scollegato: niente campione, la sua sequenza si chiude
+    long arrival_ns = 0;
+    bool alive = true; // false: il writer dell'aereo è sparito, telemetry non vale
+    bool show = true;  // false per i campioni di un batch prima dell'ultimo: entrano solo nelle statistiche
+    SystemStatsV2 telemetry;
+};
+
+constexpr long DASHBOARD_WINDOW_NS = 10000000000L; // finestra dei percentili a schermo: 10 s
+constexpr long TARGET_CYCLE_NS = 50000000L;         // periodo atteso della telemetria: 50 ms
+constexpr size_t DASHBOARD_QUEUE = 4096;   // eventi in attesa per ogni listener, a coda piena si scartano e si contano
+constexpr int DASHBOARD_REFRESH_HZ = 20;   // ridisegni al secondo del thread della dashboard
+constexpr const char* DASHBOARD_MODE_ENV = "FBW_DASHBOARD";   // thread (default) o inline
+constexpr const char* DASHBOARD_HZ_ENV = "FBW_DASHBOARD_HZ";
+constexpr const char* READER_MODE_ENV = "FBW_READER";         // listener (default) o waitset
+constexpr const char* READER_BATCH_ENV = "FBW_READER_BATCH";
+constexpr const char* READER_CORE_ENV = "FBW_READER_CORE";
+constexpr const char* READER_PRIORITY_ENV = "FBW_READER_PRIORITY";
+
+// variabile d'ambiente intera, fallback se non c'è
+int env_int(const char* name, int fallback) {
+    const char* env = std::getenv(name);
+    return env != nullptr ? std::atoi(env) : fallback;
+}
+
+long steady_ns() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000L + t.tv_nsec;
+}
+
+// Durata delle callback di un listener (thread di Fast DDS) o delle passate del thread WaitSet, si stampa all'uscita
+struct CallbackTimer {
+    std::atomic<long> calls{0};
+    std::atomic<long> total_ns{0};
+    std::atomic<long> max_ns{0};
+
+    void record(long ns) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        total_ns.fetch_add(ns, std::memory_order_relaxed);
+        if (ns > max_ns.load(std::memory_order_relaxed)) max_ns.store(ns, std::memory_order_relaxed);
+    }
+
+    void print(const char* name, const char* mode) const {
+        long n = calls.load();
+        if (n == 0) return;
+        printf("[MONITOR] callback %s (%s): %ld chiamate, media %.2f us, max %.2f us\n", name,
+               mode, n, total_ns.load() / 1000.0 / n, max_ns.load() / 1000.0);
+    }
+};
+
+// Aggrega gli eventi e disegna la dashboard dell'aereo seguito. La usa un thread alla volta: il thread della
+// dashboard, oppure con FBW_DASHBOARD=inline i listener stessi sotto il mutex (il comportamento di prima)
+class DashboardModel {
+    FlatHashMap<AircraftState> aircraft;
+    FlatHashMap<WriterSequence> writers; // per writer_key, solo i writer collegati
+    uint32_t followed = SINGLE_AIRCRAFT; // aereo mostrato a schermo, gli altri entrano solo nel riepilogo della flotta
+    bool follow_first = true;            // finché non se ne sceglie uno si segue il primo che arriva
+    size_t max_aircraft = FLEET_MAX_AIRCRAFT; // aerei nella tabella, quelli nuovi oltre il limite si scartano
+    long rejected = 0;                   // campioni scartati perché la tabella degli aerei era piena
+
+    // percentili dell'aereo seguito (uno solo, la memoria non cresce con la flotta): tempo fra due arrivi,
+    // scarto dai 50 ms e tempo di risposta del computer di volo (latency_us del campione)
+    RollingLatency cycle_stats;
+    RollingLatency jitter_stats;
+    RollingLatency response_stats;
+    long window_start_ns = 0;
+
+    TerminalGrid grid{ DASHBOARD_COLS, DASHBOARD_ROWS }; // frame a schermo, si mandano solo le celle cambiate
+    long last_frame_ns = 0;
 
 public:
-    void on_data_available(DataReader* reader) override {
-        SystemStats telemetry; //importo telemetry.idl
-        SampleInfo info;
-        
-        if (reader->take_next_sample(&telemetry, &info) == RETCODE_OK && info.valid_data) {
-            auto now = std::chrono::steady_clock::now();
-            
-            //instauro la logica di controllo delle statistiche
-            float cycle_time = 0.0f;
-            float current_jitter = 0.0f;
-            
-            if (!first) {
-                long diff_us = std::chrono::duration_cast<std::chrono::microseconds>(now - last_pkt_time).count();
-                cycle_time = diff_us / 1000.0f;
-                current_jitter = std::abs(cycle_time - 50.0f); // Target 50ms
-
-                if (current_jitter > max_jitter_seen) max_jitter_seen = current_jitter;
-                
-                jitter_history.push_back(current_jitter);
-                if (jitter_history.size() > 20) jitter_history.erase(jitter_history.begin());
-            }
-            last_pkt_time = now;
-            first = false;
-
-            // Media Jitter il ritardo
-            float avg_jitter = 0.0f;
-            if (!jitter_history.empty()) {
-                float sum = std::accumulate(jitter_history.begin(), jitter_history.end(), 0.0f);
-                avg_jitter = sum / jitter_history.size();
-            }
+    TelemetryVersion version = TelemetryVersion::V2;
+    std::mutex mtx; // solo inline: il reader v2 e quello dei batch possono chiamare da thread diversi
+    long min_frame_ns = 0; // tetto ai frame al secondo, serve con inline (il thread ha già il suo periodo)
 
-            // Statistiche Pacchetti
-            total_packets++;
-            if (telemetry.deadline_missed()) missed_packets++;
-            float loss_perc = (total_packets > 0) ? ((float)missed_packets / total_packets) * 100.0f : 0.0f;
+    long frames() const { return grid.frames; }
+    long bytes_written() const { return grid.bytes_written; }
 
+    bool decimated = false; // reader filtrato a max_hz: i buchi nella sequenza sono voluti, le perse non contano
 
-            {
-                std::lock_guard<std::mutex> lock(aereo_mutex);
-                shared_aereo.altitude = telemetry.altitude();
-                shared_aereo.speed = telemetry.speed();
-                shared_aereo.roll = telemetry.roll();
-                shared_aereo.pitch = telemetry.pitch();
-                shared_aereo.yaw = telemetry.yaw();
+    // prima di creare il reader: aereo da seguire e quanti se ne aspettano (le tabelle non crescono a regime)
+    void follow_aircraft(uint32_t id) {
+        followed = id;
+        follow_first = false;
+    }
+    void reserve_aircraft(size_t n) {
+        aircraft.reserve(n);
+        writers.reserve(n);
+        max_aircraft = n;
+    }
+
+    long rejected_count() const { return rejected; }
+
+    // Un writer si è scollegato (per esempio il computer di volo riavviato, che torna con un GUID nuovo): le sue
+    // sequenze escono dalla tabella e i contatori passano all'aereo, così i suoi buchi non restano "in attesa"
+    void retire_writer(uint32_t publication) {
+        std::vector<uint32_t> gone;
+        writers.for_each([&](uint32_t key, WriterSequence& w) {
+            if (w.publication != publication) return;
+            w.sequence.close();
+            AircraftState* state = aircraft.find(w.aircraft_id);
+            if (state != nullptr) state->retired.add(w.sequence, false);
+            gone.push_back(key);
+        });
+        for (uint32_t key : gone) writers.erase(key);
+    }
 
-                        snprintf(shared_aereo.status_msg, sizeof(shared_aereo.status_msg), "%s", telemetry.status_msg().c_str());
+    // aggiorna lo stato dell'aereo, true se cambia quello che c'è a schermo
+    bool apply(const DashboardEvent& e) {
+        if (e.writer_gone) {
+            retire_writer(e.publication);
+            return !follow_first;
+        }
+        // l'id arriva dalla rete: un writer che ne inventa sempre di nuovi non deve far crescere la tabella
+        AircraftState* slot = aircraft.find(e.aircraft_id);
+        if (slot == nullptr) {
+            if (aircraft.size() >= max_aircraft) {
+                rejected++;
+                return false;
             }
+            slot = &aircraft[e.aircraft_id];
+        }
+        AircraftState& state = *slot;
+        state.alive = e.alive;
+        if (!e.alive) return false;
+        state.total_packets++;
+        WriterSequence& writer = writers[writer_key(e.publication, e.aircraft_id)];
+        writer.aircraft_id = e.aircraft_id;
+        writer.publication = e.publication;
+        writer.sequence.record(e.telemetry.packet_id());
+        if (!e.show) return false;
+        if (follow_first) follow_aircraft(e.aircraft_id);
+        if (e.aircraft_id != followed) return false;
+
+        //instauro la logica di controllo delle statistiche
+        if (!state.first) {
+            long cycle_ns = e.arrival_ns - state.last_arrival_ns;
+            state.cycle_time = cycle_ns / 1000000.0f;
+            cycle_stats.record((uint64_t) cycle_ns);
+            jitter_stats.record((uint64_t) std::labs(cycle_ns - TARGET_CYCLE_NS));
+        }
+        response_stats.record((uint64_t) e.telemetry.latency_us() * 1000);
+        if (window_start_ns == 0) {
+            window_start_ns = e.arrival_ns;
+        } else if (e.arrival_ns - window_start_ns >= DASHBOARD_WINDOW_NS) {
+            cycle_stats.roll();
+            jitter_stats.roll();
+            response_stats.roll();
+            window_start_ns = e.arrival_ns;
+        }
+        state.last_arrival_ns = e.arrival_ns;
+        state.first = false;
+        state.last = e.telemetry;
+        return true;
+    }
 
-            std::string status = telemetry.status_msg().c_str();
+    // dashboard nel terminale e dati per la finestra dell'aereo seguito; dropped: eventi persi a coda piena
+    void render(long dropped) {
+        AircraftState* followed_state = follow_first ? nullptr : aircraft.find(followed);
+        if (followed_state == nullptr || followed_state->first) return;
+        AircraftState& state = *followed_state;
+        const SystemStatsV2& telemetry = state.last;
 
-            bool alarm_crit = (status.find("ALARM") != std::string::npos ||
-                               status.find("PULL UP") != std::string::npos ||
-                               status.find("QUOTA BASSA") != std::string::npos ||
-                               status.find("PULL DOWN") != std::string::npos ||
-                               status.find("HIGH ALTITUDE") != std::string::npos ||
-                               telemetry.altitude() < 200.0f ||
-                               telemetry.altitude() > 15000.0f);
+        // Media Jitter il ritardo, sulla finestra in corso
+        float avg_jitter = (float) (jitter_stats.recent().mean_ns() / 1e6);
 
-            bool alarm_warn = (status.find("WARN") != std::string::npos || avg_jitter > 5.0f);
+        {
+            std::lock_guard<std::mutex> lock(aereo_mutex);
+            shared_aereo.altitude = telemetry.altitude();
+            shared_aereo.speed = telemetry.speed();
+            shared_aereo.roll = telemetry.roll();
+            shared_aereo.pitch = telemetry.pitch();
+            shared_aereo.yaw = telemetry.yaw();
 
-            std::cout << "\033[2J\033[1;1H";
+                    snprintf(shared_aereo.status_msg, sizeof(shared_aereo.status_msg), "%s", status_text(telemetry.status()));
+        }
 
-            if (alarm_crit) std::cout << "\033[1;41m";
-            else if (alarm_warn) std::cout << "\033[1;43m";
-            else std::cout << "\033[1;44m";
+        // al massimo un frame ogni min_frame_ns (inline: la callback arriva a ogni campione)
+        long now = steady_ns();
+        if (now - last_frame_ns < min_frame_ns) return;
+        last_frame_ns = now;
+
+        DashboardFrame frame;
+        frame.telemetry = telemetry;
+        frame.cycle_time = state.cycle_time;
+        frame.avg_jitter = avg_jitter;
+        frame.total_packets = state.total_packets;
+        frame.decimated = decimated;
+        frame.sequence.add(state.retired);
+        writers.for_each([&](uint32_t, const WriterSequence& w) {
+            if (w.aircraft_id == followed) frame.sequence.add(w.sequence);
+            if (version == TelemetryVersion::FLEET) frame.fleet_sequence.add(w.sequence);
+        });
+        frame.cycle = &cycle_stats;
+        frame.jitter = &jitter_stats;
+        frame.response = &response_stats;
+        frame.dropped = dropped;
+        if (version == TelemetryVersion::FLEET) {
+            frame.fleet = true;
+            frame.aircraft_id = followed;
+            frame.fleet_size = aircraft.size();
+            aircraft.for_each([&](uint32_t, const AircraftState& a) {
+                frame.fleet_sequence.add(a.retired);
+                if (a.alive) frame.fleet_alive++;
+                frame.fleet_packets += a.total_packets;
+            });
+        }
+        draw_dashboard(grid, frame);
+        grid.flush(STDOUT_FILENO);
+    }
+};
 
-            std::cout << "############################################################\n";
-            std::cout << "           TORRE DI CONTROLLO - MONITORAGGIO REAL-TIME      \n";
-            std::cout << "############################################################\n";
-            std::cout << "\033[0m\n";
+// Coda fra un listener e la dashboard, una per reader: i listener di reader diversi possono girare su thread
+// diversi e la SpscQueue ha un produttore solo. Con FBW_DASHBOARD=inline l'evento si applica e si disegna subito.
+// I writer scollegati arrivano dal thread di discovery, un secondo produttore: vanno in una lista a parte con il mutex
+class DashboardFeed {
+    SpscQueue<DashboardEvent, DASHBOARD_QUEUE> queue;
+    alignas(64) std::atomic<long> dropped{0}; // eventi scartati a coda piena (lo scrive solo il listener)
+    std::mutex gone_mtx;
+    std::vector<uint32_t> gone; // publication dei writer scollegati, in attesa del thread della dashboard
+    DashboardModel& model;
+    bool inline_render;
 
-            std::cout << "\033[1;36m>>> TELEMETRIA DI VOLO <<<\033[0m            \033[1;35m>>> DIAGNOSTICA CORE & THREAD <<<\033[0m\n";
+public:
+    CallbackTimer timer;
 
-            std::cout << " ALTITUDINE : " << std::setw(5) << (int)telemetry.altitude() << " m ";
-            if(telemetry.altitude() < 200.0f || telemetry.altitude() > 14000.0f) {
-                std::cout << "\033[1;31m[CRIT]\033[0m";
-            } else {
-                std::cout << "      ";
-            }
+    DashboardFeed(DashboardModel& m, bool inline_mode) : model(m), inline_render(inline_mode) {}
 
-            std::cout << "   |   Cycle Time : " << std::fixed << std::setprecision(2) << cycle_time << " ms ";
-            if(cycle_time > 55 || cycle_time < 45) {
-                std::cout << "\033[1;33m[UNSTABLE]\033[0m";
-            } else {
-                std::cout << "\033[1;32m[OK]      \033[0m";
-            }
-            std::cout << "\n";
+    // lato listener: con il thread della dashboard niente lock e niente stampa, a coda piena l'evento si perde
+    void deliver(const DashboardEvent& e) {
+        if (inline_render) {
+            std::lock_guard<std::mutex> lock(model.mtx);
+            if (model.apply(e)) model.render(0);
+            return;
+        }
+        if (!queue.try_push(e)) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
 
-            std::cout << " ROLL (X)   : " << std::setw(6) << telemetry.roll() << " rad ";
-            if(std::abs(telemetry.roll()) > 1.2) {
-                std::cout << "\033[1;33m[WARN]\033[0m";
-            } else {
-                std::cout << "      ";
+    // lato thread della dashboard: applica tutto quello che è in coda e poi i writer scollegati, true se c'è da
+    // ridisegnare. Un campione del writer rimasto in coda dopo questo giro riapre solo una sequenza nuova
+    bool drain() {
+        DashboardEvent batch[64];
+        bool changed = false;
+        size_t n;
+        while ((n = queue.pop_batch(batch, 64)) > 0) {
+            for (size_t i = 0; i < n; i++) {
+                if (model.apply(batch[i])) changed = true;
             }
+        }
+        std::vector<uint32_t> retired;
+        {
+            std::lock_guard<std::mutex> lock(gone_mtx);
+            retired.swap(gone);
+        }
+        DashboardEvent e;
+        e.writer_gone = true;
+        for (uint32_t publication : retired) {
+            e.publication = publication;
+            if (model.apply(e)) changed = true;
+        }
+        return changed;
+    }
 
-            std::cout << "   |   Jitter Avg : " << std::setw(5) << avg_jitter << " ms ";
-            if(avg_jitter > 2.0) {
-                std::cout << "\033[1;31m[LAG]     \033[0m";
-            } else {
-                std::cout << "\033[1;32m[SMOOTH]  \033[0m";
-            }
-            std::cout << "\n";
+    // lato discovery (on_subscription_matched): inline si applica subito sotto model.mtx, altrimenti si mette
+    // da parte per drain(), che la applica dopo i campioni già in coda
+    void deliver_writer_gone(const eprosima::fastdds::rtps::InstanceHandle_t& publication) {
+        if (inline_render) {
+            DashboardEvent e;
+            e.writer_gone = true;
+            e.publication = publication_key(publication);
+            deliver(e);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(gone_mtx);
+        gone.push_back(publication_key(publication));
+    }
+
+    long dropped_count() const { return dropped.load(std::memory_order_relaxed); }
+};
 
-            std::cout << " PITCH (Y)  : " << std::setw(6) << telemetry.pitch() << " rad       ";
-            std::cout << "   |   RAM Access : " << std::setw(5) << (int)telemetry.latency_us() << " us \n";
+// Listener della telemetria: prende i campioni, li converte in v2 e li passa alla dashboard con l'istante di arrivo
+class DashboardListener : public DataReaderListener {
+    DashboardFeed& feed;
+
+    // la v1 si converte in v2 all'arrivo: il testo dello stato si confronta una volta sola, poi si lavora sul codice
+    bool take_sample(DataReader* reader, SystemStatsV2& out, SampleInfo& info) {
+        if (version == TelemetryVersion::V2) return take_telemetry(reader, out, info);
+        SystemStats v1;
+        if (!take_telemetry(reader, v1, info)) return false;
+        to_v2(v1, out);
+        return true;
+    }
 
-            std::cout << " YAW (Z)    : " << std::setw(6) << telemetry.yaw() << " rad ";
-            if(std::abs(telemetry.yaw()) > 1.2) {
-                std::cout << "\033[1;33m[WARN]\033[0m";
-            } else {
-                std::cout << "      ";
+    // fleet: tutti i campioni arrivati, ognuno con il suo aereo. Quando il writer di un aereo sparisce
+    // arriva un campione senza dati e la chiave si recupera dall'handle dell'istanza
+    void take_fleet(DataReader* reader, long arrival_ns) {
+        AircraftTelemetry sample;
+        SampleInfo info;
+        DashboardEvent e;
+        e.arrival_ns = arrival_ns;
+        while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {
+            e.alive = info.valid_data;
+            if (!info.valid_data && reader->get_key_value(&sample, info.instance_handle) != RETCODE_OK) continue;
+            e.aircraft_id = sample.aircraft_id();
+            if (e.alive) {
+                e.publication = publication_key(info.publication_handle);
+                to_v2(sample, e.telemetry);
             }
+            feed.deliver(e);
+        }
+    }
 
-            std::cout << "   |   Packet Loss   : " << std::fixed << std::setprecision(1) << loss_perc << " %\n";
+public:
+    TelemetryVersion version = TelemetryVersion::V2; // versione del reader attuale, si imposta prima di crearlo
 
-            std::cout << " SPEED      : " << std::setw(6) << (int)telemetry.speed()*2 << " Km/h \n\n";
+    explicit DashboardListener(DashboardFeed& f) : feed(f) {}
 
-            std::cout << " STATO CARICO CPU (Jitter): " << Barre_Caricamento(avg_jitter, 10.0f, 20, "\033[1;33m") << "\n";
-            std::cout << " STATO ALTITUDINE (Quota) : " << Barre_Caricamento(telemetry.altitude(), 15000.0f, 20, "\033[1;32m") << "\n\n";
+    // anche con FBW_READER=waitset: il listener resta attaccato per questo stato
+    void on_subscription_matched(DataReader*, const SubscriptionMatchedStatus& info) override {
+        if (info.current_count_change < 0) feed.deliver_writer_gone(info.last_publication_handle);
+    }
 
-            std::cout << "------------------------------------------------------------\n";
-            std::cout << "CONDIZIONE VOLO : ";
+    // WaitSet: tutto quello che c'è, a gruppi di max_batch campioni in prestito. Con v1 e v2 a schermo va l'ultimo
+    // di ogni gruppo (quelli arrivati insieme hanno lo stesso istante di arrivo), con fleet tutti
+    void take_all(DataReader* reader, int32_t max_batch) {
+        long start = steady_ns();
+        DashboardEvent e;
+        e.arrival_ns = start;
+        if (version == TelemetryVersion::FLEET) {
+            take_batch<AircraftTelemetry>(reader, max_batch, [&](const AircraftTelemetry& sample, const SampleInfo& info, bool) {
+                e.alive = info.valid_data;
+                if (e.alive) {
+                    e.aircraft_id = sample.aircraft_id();
+                    e.publication = publication_key(info.publication_handle);
+                    to_v2(sample, e.telemetry);
+                } else {
+                    AircraftTelemetry key;
+                    if (reader->get_key_value(&key, info.instance_handle) != RETCODE_OK) return;
+                    e.aircraft_id = key.aircraft_id();
+                }
+                feed.deliver(e);
+            });
+        } else if (version == TelemetryVersion::V2) {
+            take_batch<SystemStatsV2>(reader, max_batch, [&](const SystemStatsV2& sample, const SampleInfo& info, bool last) {
+                if (!info.valid_data) return;
+                e.publication = publication_key(info.publication_handle);
+                e.telemetry = sample;
+                e.show = last;
+                feed.deliver(e);
+            });
+        } else if (TELEMETRY_LOAN) {
+            SystemStats v1;
+            take_batch<SystemStatsPlain>(reader, max_batch, [&](const SystemStatsPlain& sample, const SampleInfo& info, bool last) {
+                if (!info.valid_data) return;
+                e.publication = publication_key(info.publication_handle);
+                copy_telemetry(sample, v1);
+                to_v2(v1, e.telemetry);
+                e.show = last;
+                feed.deliver(e);
+            });
+        } else {
+            take_batch<SystemStats>(reader, max_batch, [&](const SystemStats& sample, const SampleInfo& info, bool last) {
+                if (!info.valid_data) return;
+                e.publication = publication_key(info.publication_handle);
+                to_v2(sample, e.telemetry);
+                e.show = last;
+                feed.deliver(e);
+            });
+        }
+        feed.timer.record(steady_ns() - start);
+    }
 
-            if (alarm_crit) {
-                std::cout << "\033[1;31m !!! IN PERICOLO: " << status << " (WARNING) !!!\033[0m\n";
-            }
-            else if (alarm_warn) {
-                std::cout << "\033[1;33m " << status << "\033[0m\n";
+    void on_data_available(DataReader* reader) override {
+        long start = steady_ns();
+        if (version == TelemetryVersion::FLEET) {
+            take_fleet(reader, start);
+        } else {
+            DashboardEvent e; //importo telemetry.idl
+            e.arrival_ns = start;
+            // con FLIGHT_TELEMETRY=LOAN il campione arriva in prestito dal data-sharing e viene convertito qui
+            SampleInfo info;
+            if (take_sample(reader, e.telemetry, info)) {
+                e.publication = publication_key(info.publication_handle);
+                feed.deliver(e);
             }
-            else {
-                std::cout << "\033[1;32m " << status << "\033[0m\n";
+        }
+        feed.timer.record(steady_ns() - start);
+    }
+};
+
+// TelemetryBatchTopic: ogni campione entra nelle statistiche, a schermo va solo l'ultimo
+class BatchListener : public DataReaderListener {
+    DashboardFeed& feed;
+    SystemStatsBatch batch; // la sequence tiene la capacità fra un batch e l'altro
+
+public:
+    explicit BatchListener(DashboardFeed& f) : feed(f) {}
+
+    void on_subscription_matched(DataReader*, const SubscriptionMatchedStatus& info) override {
+        if (info.current_count_change < 0) feed.deliver_writer_gone(info.last_publication_handle);
+    }
+
+    // WaitSet: come la callback, ma tutti i batch arrivati a gruppi di max_batch in prestito
+    void take_all(DataReader* reader, int32_t max_batch) {
+        long start = steady_ns();
+        DashboardEvent e;
+        e.arrival_ns = start;
+        take_batch<SystemStatsBatch>(reader, max_batch, [&](const SystemStatsBatch& b, const SampleInfo& info, bool) {
+            if (!info.valid_data) return;
+            e.publication = publication_key(info.publication_handle);
+            size_t n = b.samples().size();
+            for (size_t i = 0; i < n; i++) {
+                e.telemetry = b.samples()[i];
+                e.show = i + 1 == n;
+                feed.deliver(e);
             }
+        });
+        feed.timer.record(steady_ns() - start);
+    }
 
-            std::cout << " RETE DDS   : " << total_packets << " Rx | " << missed_packets << " Perse (" << loss_perc << "%)\n";
-            std::cout << "------------------------------------------------------------\n";
-            
-            if (avg_jitter > 10.0f) {
-                std::cout << "\033[1;31m [!] ALERT: IL SISTEMA SINGLE CORE E' SOVRACCARICO! \033[0m\n";
-            } else {
-                std::cout << "\033[1;32m [OK] Scheduling Thread Ottimale. \033[0m\n";
+    void on_data_available(DataReader* reader) override {
+        long start = steady_ns();
+        SampleInfo info;
+        if (reader->take_next_sample(&batch, &info) == RETCODE_OK && info.valid_data) {
+            DashboardEvent e;
+            e.arrival_ns = start;
+            e.publication = publication_key(info.publication_handle);
+            size_t n = batch.samples().size();
+            for (size_t i = 0; i < n; i++) {
+                e.telemetry = batch.samples()[i];
+                e.show = i + 1 == n;
+                feed.deliver(e);
             }
         }
+        feed.timer.record(steady_ns() - start);
     }
 };
 
-int main() {
+// Thread della dashboard: a ogni periodo svuota le code dei listener e ridisegna una volta sola se è cambiato
+// qualcosa, così la stampa nel terminale non passa più dalle callback di Fast DDS
+void dashboard_task(DashboardModel* model, std::vector<DashboardFeed*> feeds, int refresh_hz, std::atomic<bool>* running) {
+    auto period = std::chrono::nanoseconds(1000000000L / refresh_hz);
+    auto next = std::chrono::steady_clock::now();
+    while (running->load()) {
+        next += period;
+        std::this_thread::sleep_until(next);
+        bool changed = false;
+        long dropped = 0;
+        for (DashboardFeed* feed : feeds) {
+            if (feed->drain()) changed = true;
+            dropped += feed->dropped_count();
+        }
+        if (changed) model->render(dropped);
+    }
+}
 
+// Crea topic e reader della versione richiesta (V1, V2 o FLEET), con FLIGHT_TELEMETRY=LOAN la v1 è SystemStatsPlain.
+// Con max_rate_hz > 0 il reader sta su un topic filtrato che lascia passare al massimo max_rate_hz campioni al secondo
+DataReader* create_telemetry_reader(DomainParticipant* participant, Subscriber* sub, TelemetryVersion version,
+                                    const DataReaderQos& qos, DashboardListener& listener, const StatusMask& mask,
+                                    double max_rate_hz, Topic*& topic, ContentFilteredTopic*& filtered) {
+    bool v2 = version == TelemetryVersion::V2;
+    bool fleet = version == TelemetryVersion::FLEET;
+    TypeSupport type(fleet ? static_cast<TopicDataType*>(new AircraftTelemetryPubSubType())
+                     : v2 ? static_cast<TopicDataType*>(new SystemStatsV2PubSubType())
+                     : TELEMETRY_LOAN ? static_cast<TopicDataType*>(new SystemStatsPlainPubSubType()) : new SystemStatsPubSubType());
+    type.register_type(participant);
+
+    topic = participant->create_topic(fleet ? TELEMETRY_FLEET_TOPIC : v2 ? TELEMETRY_V2_TOPIC
+                                      : TELEMETRY_LOAN ? TELEMETRY_PLAIN_TOPIC : TELEMETRY_TOPIC,
+                                      type.get_type_name(), TOPIC_QOS_DEFAULT);
+    if (topic == nullptr) return nullptr;
+
+    listener.version = version;
+    filtered = nullptr;
+    if (max_rate_hz > 0.0) {
+        filtered = create_decimated_topic(participant, topic, max_rate_hz);
+        if (filtered == nullptr) return nullptr;
+        return sub->create_datareader(filtered, qos, &listener, mask);
+    }
+    return sub->create_datareader(topic, qos, &listener, mask);
+}
+
+// Reader dei batch v2, va insieme a quello della v2 (il computer di volo ne usa uno solo, dipende da --batch)
+DataReader* create_batch_reader(DomainParticipant* participant, Subscriber* sub, const DataReaderQos& qos,
+                                BatchListener& listener, const StatusMask& mask, Topic*& topic) {
+    TypeSupport type(new SystemStatsBatchPubSubType());
+    type.register_type(participant);
+
+    topic = participant->create_topic(TELEMETRY_BATCH_TOPIC, type.get_type_name(), TOPIC_QOS_DEFAULT);
+    if (topic == nullptr) return nullptr;
+    return sub->create_datareader(topic, qos, &listener, mask);
+}
+
+// Aspetta che almeno un writer si colleghi a uno dei reader, false se entro timeout_ms non arriva nessuno
+bool wait_for_writer(std::initializer_list<DataReader*> readers, int timeout_ms) {
+    SubscriptionMatchedStatus matched;
+    for (int waited = 0; waited < timeout_ms; waited += 50) {
+        for (DataReader* reader : readers) {
+            if (reader == nullptr) continue;
+            reader->get_subscription_matched_status(matched);
+            if (matched.current_count > 0) return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+}
+
+// USO: ./MonitorApp [v1|v2|fleet|auto]   (default auto: v2 se qualcuno la pubblica entro 2 s, altrimenti v1;
+//                                          la v2 si ascolta sia campione per campione sia a pacchetti)
+//      ./MonitorApp [v1|v2|auto] [max_hz]   al massimo max_hz campioni al secondo (i batch non si decimano)
+//      ./MonitorApp fleet [max_hz] [aircraft_id]   tutta la flotta, a schermo l'aereo scelto (default il primo
+//                                                  che arriva); il filtro a max_hz vale per tutta la flotta insieme
+//      trasporto DDS con FBW_TRANSPORT=default|shm|udp|intra (deve andare d'accordo con quello del computer di volo)
+//      statistiche Fast DDS con FBW_STATISTICS=off|basic|full
+//      dashboard con FBW_DASHBOARD=thread|inline (default thread), al massimo FBW_DASHBOARD_HZ frame al secondo
+//      (default 20) e solo con le celle cambiate; all'uscita stampa la durata delle callback dei listener
+//      e i byte mandati al terminale
+//      lettura con FBW_READER=listener|waitset (default listener); con waitset un thread dorme sul WaitSet e prende
+//      i campioni con take() in prestito a gruppi di FBW_READER_BATCH (default 32), FBW_READER_CORE e
+//      FBW_READER_PRIORITY (SCHED_FIFO, serve sudo) scelgono core e priorità del thread
+int main(int argc, char** argv) {
+
+    // prima di ogni thread (anche quelli di Fast DDS): SIGUSR1 lo prende solo il thread di StatisticsSwitch
+    StatisticsSwitch::block_signal();
+
+    TelemetryVersion requested = TelemetryVersion::AUTO;
+    if (argc > 1 && !parse_telemetry_version(argv[1], requested)) {
+        std::cerr << "Versione telemetria sconosciuta: " << argv[1] << " (v1, v2, fleet o auto)" << std::endl;
+        return 1;
+    }
+    double max_rate_hz = (argc > 2) ? std::stod(argv[2]) : 0.0; // 0 = tutti i campioni
+    uint32_t followed_aircraft = SINGLE_AIRCRAFT;
+    if (argc > 3 && !parse_aircraft_id(argv[3], followed_aircraft)) {
+        std::cerr << "aircraft_id non valido: " << argv[3] << " (intero da 0 a 4294967295)" << std::endl;
+        return 1;
+    }
+
+    TransportProfile transport = transport_profile_from_env();
+    StatisticsLevel statistics = statistics_level_from_env();
     DomainParticipantQos pqos;
     pqos.name("Monitor_Node_Leonardo");
-
-    pqos.properties().properties().emplace_back("fastdds.statistics",
-        "HISTORY_LATENCY;"
-        "NETWORK_LATENCY;"
-        "PUBLICATION_THROUGHPUT;"
-        "SUBSCRIPTION_THROUGHPUT;"
-        "HEARTBEAT_COUNT;"
-        "ACKNACK_COUNT;"
-        "DISCOVERY_STATISTICS;"
-        "PHYSICAL_DATA_STATISTICS");
+    setup_transport(pqos, transport);
 
     //creo il participant
     DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
     if (participant == nullptr) return 1;
 
-    auto* stat_participant = eprosima::fastdds::statistics::dds::DomainParticipant::narrow(participant);
-    if (stat_participant != nullptr) {
-        // Traffico e Affidabilità
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::SUBSCRIPTION_THROUGHPUT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::ACKNACK_COUNT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::HEARTBEAT_COUNT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-        // Latenza della rete DDS
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::HISTORY_LATENCY_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::NETWORK_LATENCY_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-        // Latenza della rete DDS
-        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::HISTORY_LATENCY_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-    }
-
-    TypeSupport type(new SystemStatsPubSubType());
-    type.register_type(participant);
+    // statistiche del livello scelto (off di default), ognuna una volta sola
+    set_statistics_level(participant, StatisticsLevel::OFF, statistics);
+    StatisticsSwitch statistics_switch; // kill -USR1 <pid>: statistiche full e ritorno, senza riavviare
+    statistics_switch.start(participant, statistics);
 
     Subscriber* sub = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
-    Topic* topic = participant->create_topic("TelemetryTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
 
     //creo il reader
     DataReaderQos dr_qos = DATAREADER_QOS_DEFAULT;
@@ -246,21 +642,102 @@ int main() {
     // Reliability del quality of service
     dr_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
     dr_qos.durability().kind = VOLATILE_DURABILITY_QOS;
+    if (TELEMETRY_LOAN && transport_allows_data_sharing(transport)) enable_data_sharing(dr_qos);
+
+    // il batch non è plain: niente data-sharing
+    DataReaderQos batch_qos = dr_qos;
+    batch_qos.data_sharing().off();
+
+    // flotta: un campione per aereo (KEEP_LAST 1 per istanza) fino a FLEET_MAX_AIRCRAFT istanze,
+    // il default di Fast DDS ne accetterebbe solo 10
+    if (requested == TelemetryVersion::FLEET) {
+        dr_qos.data_sharing().off();
+        dr_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+        dr_qos.history().depth = 1;
+        dr_qos.resource_limits().max_instances = FLEET_MAX_AIRCRAFT;
+        dr_qos.resource_limits().max_samples_per_instance = 1;
+        dr_qos.resource_limits().max_samples = FLEET_MAX_AIRCRAFT;
+    }
 
-    // Abilitiamo le statistiche lato ricezione
-    dr_qos.properties().properties().emplace_back("fastdds.statistics",
-        "SUBSCRIPTION_THROUGHPUT;"
-        "HISTORY_LATENCY;"
-        "ACKNACK_COUNT");
-
-    DashboardListener listener;
-    DataReader* reader = sub->create_datareader(topic, dr_qos, &listener);
+    // FBW_DASHBOARD=inline: aggiornamento e stampa dentro la callback come prima, per confrontare la durata
+    const char* mode_env = std::getenv(DASHBOARD_MODE_ENV);
+    bool inline_render = mode_env != nullptr && std::string(mode_env) == "inline";
+    int refresh_hz = env_int(DASHBOARD_HZ_ENV, DASHBOARD_REFRESH_HZ);
+    if (refresh_hz <= 0) refresh_hz = DASHBOARD_REFRESH_HZ;
+
+    // FBW_READER=waitset: i reader non chiamano il listener, li svuota un thread WaitSet con take() a gruppi
+    // di FBW_READER_BATCH campioni, sul core FBW_READER_CORE con priorità SCHED_FIFO FBW_READER_PRIORITY
+    const char* reader_env = std::getenv(READER_MODE_ENV);
+    bool use_waitset = reader_env != nullptr && std::string(reader_env) == "waitset";
+    int32_t reader_batch = env_int(READER_BATCH_ENV, READER_DEFAULT_BATCH);
+    if (reader_batch <= 0) reader_batch = READER_DEFAULT_BATCH;
+    int reader_core = env_int(READER_CORE_ENV, -1);
+    int reader_priority = env_int(READER_PRIORITY_ENV, 0);
+    // con il WaitSet al listener resta solo subscription_matched, per chiudere le sequenze dei writer che se ne vanno
+    StatusMask listener_mask = use_waitset ? StatusMask::subscription_matched() : StatusMask::all();
+
+    DashboardModel model;
+    DashboardFeed feed(model, inline_render);
+    DashboardFeed batch_feed(model, inline_render);
+    DashboardListener listener(feed);
+    BatchListener batch_listener(batch_feed);
+    if (argc > 3) model.follow_aircraft(followed_aircraft);
+    if (inline_render) model.min_frame_ns = 1000000000L / refresh_hz;
+    model.decimated = max_rate_hz > 0.0;
+    if (requested == TelemetryVersion::FLEET) model.reserve_aircraft(FLEET_MAX_AIRCRAFT);
+    Topic* topic = nullptr;
+    ContentFilteredTopic* filtered = nullptr;
+    Topic* batch_topic = nullptr;
+    DataReader* batch_reader = nullptr;
+    TelemetryVersion version = requested == TelemetryVersion::V1 || requested == TelemetryVersion::FLEET
+                               ? requested : TelemetryVersion::V2;
+    model.version = version; // solo FLEET cambia la stampa, il ripiego su v1 non conta
+    DataReader* reader = create_telemetry_reader(participant, sub, version, dr_qos, listener, listener_mask, max_rate_hz, topic, filtered);
+    if (version == TelemetryVersion::V2) {
+        batch_reader = create_batch_reader(participant, sub, batch_qos, batch_listener, listener_mask, batch_topic);
+        if (batch_reader == nullptr) return 1;
+    }
 
+    if (reader != nullptr && requested == TelemetryVersion::AUTO && !wait_for_writer({ reader, batch_reader }, 2000)) {
+        // nessun computer di volo pubblica la v2 (né da sola né a pacchetti): torno alla v1
+        sub->delete_datareader(reader);
+        sub->delete_datareader(batch_reader);
+        if (filtered != nullptr) participant->delete_contentfilteredtopic(filtered);
+        participant->delete_topic(topic);
+        participant->delete_topic(batch_topic);
+        batch_reader = nullptr;
+        batch_topic = nullptr;
+        version = TelemetryVersion::V1;
+        reader = create_telemetry_reader(participant, sub, version, dr_qos, listener, listener_mask, max_rate_hz, topic, filtered);
+    }
 
     if (reader == nullptr) {
         return 1;
     }
-    std::cout << "=== DASHBOARD MONITOR IN ASCOLTO (RELIABLE) ===" << std::endl;
+    std::cout << "=== DASHBOARD MONITOR IN ASCOLTO (RELIABLE, telemetria " << telemetry_version_name(version)
+              << ", trasporto " << transport_profile_name(transport)
+              << ", statistiche " << statistics_level_name(statistics);
+    if (max_rate_hz > 0.0) std::cout << ", al massimo " << max_rate_hz << " campioni/s";
+    if (use_waitset) std::cout << ", reader WaitSet a gruppi di " << reader_batch;
+    if (inline_render) std::cout << ", dashboard inline";
+    else std::cout << ", dashboard a " << refresh_hz << " Hz";
+    std::cout << ") ===" << std::endl;
+
+    WaitSetReader waitset_reader;
+    if (use_waitset) {
+        waitset_reader.attach(reader, [&](DataReader* r) { listener.take_all(r, reader_batch); });
+        if (batch_reader != nullptr) {
+            waitset_reader.attach(batch_reader, [&](DataReader* r) { batch_listener.take_all(r, reader_batch); });
+        }
+        waitset_reader.start(reader_core, reader_priority);
+    }
+
+    std::atomic<bool> running{true};
+    std::thread dashboard_thread;
+    if (!inline_render) {
+        dashboard_thread = std::thread(dashboard_task, &model, std::vector<DashboardFeed*>{ &feed, &batch_feed },
+                                       refresh_hz, &running);
+    }
 
 
 
@@ -281,10 +758,26 @@ int main() {
         display.Draw(local_aereo);
     }
 
+    waitset_reader.shutdown();
+    statistics_switch.shutdown();
     sub->delete_datareader(reader);
+    if (batch_reader != nullptr) sub->delete_datareader(batch_reader);
     participant->delete_subscriber(sub);
+    if (filtered != nullptr) participant->delete_contentfilteredtopic(filtered);
     participant->delete_topic(topic);
+    if (batch_topic != nullptr) participant->delete_topic(batch_topic);
     DomainParticipantFactory::get_instance()->delete_participant(participant);
 
+    running = false;
+    if (dashboard_thread.joinable()) dashboard_thread.join();
+    std::string mode = std::string(use_waitset ? "waitset" : "listener") + ", dashboard " + (inline_render ? "inline" : "thread");
+    feed.timer.print("telemetria", mode.c_str());
+    batch_feed.timer.print("batch", mode.c_str());
+    if (model.rejected_count() > 0) {
+        printf("[MONITOR] %ld campioni di aerei oltre i %d della tabella scartati\n", model.rejected_count(), FLEET_MAX_AIRCRAFT);
+    }
+    if (use_waitset) printf("[MONITOR] WaitSet: %ld risvegli\n", waitset_reader.wakeup_count());
+    printf("[MONITOR] dashboard: %ld frame, %.1f kB scritti sul terminale\n", model.frames(), model.bytes_written() / 1024.0);
+
     return 0;
 }
@@ -0,0 +1,94 @@
+//comandi del pilota scritti in un file al posto della tastiera, per far volare FlightSim senza finestra
+//formato: una riga per comando "<inizio_s> <fine_s> <comando>", le righe che iniziano con # sono commenti
+//comandi: pitch_up pitch_down roll_left roll_right yaw_left yaw_right throttle_up throttle_down engine_cut landing
+#ifndef PILOT_SCRIPT_HPP
+#define PILOT_SCRIPT_HPP
+
+#include "FlightPhysics.hpp"
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <iostream>
+
+class PilotScript {
+    struct Command {
+        double start_s;
+        double end_s;
+        bool PilotInput::* key;
+    };
+
+    std::vector<Command> commands;
+    double length_s = 0.0;
+
+    static bool PilotInput::* parse_key(const std::string& name) {
+        if (name == "pitch_up") return &PilotInput::pitch_up;
+        if (name == "pitch_down") return &PilotInput::pitch_down;
+        if (name == "roll_left") return &PilotInput::roll_left;
+        if (name == "roll_right") return &PilotInput::roll_right;
+        if (name == "yaw_left") return &PilotInput::yaw_left;
+        if (name == "yaw_right") return &PilotInput::yaw_right;
+        if (name == "throttle_up") return &PilotInput::throttle_up;
+        if (name == "throttle_down") return &PilotInput::throttle_down;
+        if (name == "engine_cut") return &PilotInput::engine_cut;
+        if (name == "landing") return &PilotInput::landing_mode;
+        return nullptr;
+    }
+
+public:
+    // restituisce false (e stampa la riga) se il file non si apre o contiene un comando sconosciuto
+    bool load(const std::string& path) {
+        std::ifstream f(path);
+        if (!f) {
+            std::cerr << "Script pilota non trovato: " << path << std::endl;
+            return false;
+        }
+        std::string line;
+        int n = 0;
+        while (std::getline(f, line)) {
+            n++;
+            if (line.empty() || line[0] == '#') continue;
+            std::istringstream ss(line);
+            double start, end;
+            std::string name;
+            if (!(ss >> start >> end >> name) || !add(start, end, name)) {
+                std::cerr << path << ":" << n << " riga non valida: " << line << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool add(double start_s, double end_s, const std::string& name) {
+        bool PilotInput::* key = parse_key(name);
+        if (key == nullptr || end_s < start_s) return false;
+        commands.push_back({start_s, end_s, key});
+        if (end_s > length_s) length_s = end_s;
+        return true;
+    }
+
+    // Manovra di default (80 s): salita oltre i 13000 m (recovery_high), virata stretta (recovery_bank),
+    // picchiata sotto i 2000 m (recovery_low), motori spenti e discesa con il landing mode inserito
+    void load_default() {
+        add(0.0, 8.0, "throttle_up");
+        add(2.0, 4.0, "pitch_up");
+        add(10.0, 14.0, "roll_right");
+        add(20.0, 21.0, "pitch_down");
+        add(20.0, 24.0, "throttle_up");
+        add(40.0, 43.0, "engine_cut");
+        add(70.0, 80.0, "landing");
+        add(70.0, 74.0, "throttle_down");
+    }
+
+    PilotInput at(double t_s) const {
+        PilotInput in;
+        for (const Command& c : commands) {
+            if (t_s >= c.start_s && t_s < c.end_s) in.*(c.key) = true;
+        }
+        return in;
+    }
+
+    double length() const { return length_s; }
+};
+
+#endif
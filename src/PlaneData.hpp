@@ -0,0 +1,20 @@
+#ifndef PLANE_DATA_HPP
+#define PLANE_DATA_HPP
+
+// Struttura Dati Aereo con cui passo alla grafic ai dati
+//separata da FlightDisplay.hpp così la fisica si può usare anche senza raylib
+struct PlaneData {
+    float roll = 0.0f;
+    float pitch = 0.0f;
+    float yaw = 0.0f;
+    float altitude = 5000.0f;
+   //movimento nello spazio nelle tre dimensioni
+    float x = 0.0f;
+    float z = 0.0f;
+float speed=0.0f;
+char status_msg[64];//aggiunto per gestire nel monitor i messaggi di condizione di volo
+    bool system_active = true;
+    bool landing_mode = false;//per diabilitare il fly-by-wire
+};
+
+#endif
@@ -0,0 +1,267 @@
+//bus FlightControls tra processi diversi: il loop pilota (FlightSim) e il computer di volo (FlightComputer)
+//usano un segmento POSIX (shm_open + mmap) con mutex e condition variable condivisi tra processi
+#ifndef PROCESS_SHARED_BUS_HPP
+#define PROCESS_SHARED_BUS_HPP
+
+#include "SharedMemory.hpp"
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <atomic>
+#include <cstdio>
+#include <string>
+
+#define FBW_SHM_NAME "/fbw_flight_controls"
+
+// Layout del segmento condiviso, deve essere identico nei due eseguibili
+struct ShmBusSegment {
+    std::atomic<uint32_t> ready;        // messo a SHM_BUS_MAGIC dal creatore a inizializzazione finita
+    pid_t creator;                      // pid di FlightSim: se è morto il segmento è rimasto da un'esecuzione vecchia
+    uint64_t generation;                // istante di creazione (CLOCK_REALTIME in ns), cambia a ogni FlightSim
+    std::atomic<bool> writer_closed;    // il pilota ha chiuso, il lettore può uscire
+    pthread_mutex_t mtx;
+    pthread_cond_t cv;
+    bool new_data_available;
+    long lost;
+    FlightControls data;
+};
+
+class ProcessSharedBus {
+    static constexpr uint32_t SHM_BUS_MAGIC = 0xF1B3B005;
+    static constexpr int SHM_BUS_READY_TIMEOUT_MS = 5000; // oltre, il creatore è morto a metà inizializzazione
+
+    ShmBusSegment* seg = nullptr;
+    bool owner = false;
+    std::string shm_name;
+    uint64_t generation = 0; // quella del segmento aperto, per accorgersi che FlightSim l'ha ricreato
+    BusLatencyStats stats;
+
+    void detach() {
+        munmap(seg, sizeof(ShmBusSegment));
+        seg = nullptr;
+    }
+
+    // EPERM vuol dire che il processo c'è ma è di un altro utente
+    bool creator_alive() const { return kill(seg->creator, 0) == 0 || errno != ESRCH; }
+
+    // se il processo che aveva il lock è morto il mutex robusto ce lo dice e lo rimettiamo a posto
+    void lock() {
+        if (pthread_mutex_lock(&seg->mtx) == EOWNERDEAD) pthread_mutex_consistent(&seg->mtx);
+    }
+
+public:
+    static constexpr const char* name = "POSIX_SHM";
+
+    // create = true per chi scrive (crea e inizializza il segmento), false per chi legge (lo apre e aspetta che sia pronto)
+    // il protocollo del mutex lo decide solo chi crea il segmento
+    ProcessSharedBus(const char* shm, bool create, BusLockPolicy policy = BusLockPolicy::DEFAULT, int ceiling = 99)
+        : owner(create), shm_name(shm) {
+        int fd;
+        if (create) {
+            shm_unlink(shm); // tolgo eventuali segmenti rimasti da un'esecuzione precedente
+            fd = shm_open(shm, O_CREAT | O_EXCL | O_RDWR, 0660);
+            if (fd < 0 || ftruncate(fd, sizeof(ShmBusSegment)) != 0) {
+                perror("shm_open/ftruncate");
+                if (fd >= 0) close(fd);
+                return;
+            }
+        } else {
+            fd = shm_open(shm, O_RDWR, 0660);
+            if (fd < 0) {
+                perror("shm_open");
+                return;
+            }
+            // fra shm_open e ftruncate del creatore il segmento è lungo 0: mapparlo adesso darebbe SIGBUS al primo accesso
+            struct stat st;
+            for (int waited = 0;; waited++) {
+                if (fstat(fd, &st) != 0) {
+                    perror("fstat");
+                    close(fd);
+                    return;
+                }
+                if (st.st_size >= (off_t) sizeof(ShmBusSegment)) break;
+                if (waited >= SHM_BUS_READY_TIMEOUT_MS) {
+                    fprintf(stderr, "[SHM] %s: segmento di %ld byte dopo %d ms, il creatore non l'ha finito\n", shm,
+                            (long) st.st_size, SHM_BUS_READY_TIMEOUT_MS);
+                    close(fd);
+                    return;
+                }
+                usleep(1000);
+            }
+        }
+
+        void* p = mmap(nullptr, sizeof(ShmBusSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (p == MAP_FAILED) {
+            perror("mmap");
+            return;
+        }
+        seg = static_cast<ShmBusSegment*>(p);
+
+        if (create) {
+            pthread_mutexattr_t mattr;
+            pthread_mutexattr_init(&mattr);
+            pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+            pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+            if (policy == BusLockPolicy::INHERIT) {
+                pthread_mutexattr_setprotocol(&mattr, PTHREAD_PRIO_INHERIT);
+            } else if (policy == BusLockPolicy::PROTECT) {
+                pthread_mutexattr_setprotocol(&mattr, PTHREAD_PRIO_PROTECT);
+                pthread_mutexattr_setprioceiling(&mattr, ceiling);
+            }
+            pthread_mutex_init(&seg->mtx, &mattr);
+            pthread_mutexattr_destroy(&mattr);
+
+            // CLOCK_MONOTONIC come steady_clock, così i timeout non dipendono dall'ora di sistema
+            pthread_condattr_t cattr;
+            pthread_condattr_init(&cattr);
+            pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+            pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+            pthread_cond_init(&seg->cv, &cattr);
+            pthread_condattr_destroy(&cattr);
+
+            seg->new_data_available = false;
+            seg->lost = 0;
+            seg->writer_closed.store(false);
+            struct timespec now;
+            clock_gettime(CLOCK_REALTIME, &now);
+            seg->creator = getpid();
+            seg->generation = (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+            generation = seg->generation;
+            seg->ready.store(SHM_BUS_MAGIC, std::memory_order_release);
+        } else {
+            // aspetto che il creatore abbia finito di inizializzare mutex e cv, ma non per sempre
+            int waited = 0;
+            while (seg->ready.load(std::memory_order_acquire) != SHM_BUS_MAGIC && waited < SHM_BUS_READY_TIMEOUT_MS) {
+                usleep(1000);
+                waited++;
+            }
+            if (seg->ready.load(std::memory_order_acquire) != SHM_BUS_MAGIC) {
+                fprintf(stderr, "[SHM] %s: segmento non pronto dopo %d ms\n", shm, SHM_BUS_READY_TIMEOUT_MS);
+                detach();
+                return;
+            }
+            // un FlightSim terminato senza shm_unlink lascia il segmento pronto ma senza più nessuno che scrive
+            if (!creator_alive()) {
+                fprintf(stderr, "[SHM] %s: segmento lasciato da FlightSim terminato (pid %d)\n", shm, (int) seg->creator);
+                detach();
+                return;
+            }
+            generation = seg->generation;
+        }
+    }
+
+    ~ProcessSharedBus() {
+        if (seg == nullptr) return;
+        if (owner) close_writer();
+        detach();
+        if (owner) shm_unlink(shm_name.c_str());
+    }
+
+    ProcessSharedBus(const ProcessSharedBus&) = delete;
+    ProcessSharedBus& operator=(const ProcessSharedBus&) = delete;
+
+    bool is_open() const { return seg != nullptr; }
+
+    void write(long id, float roll, float pitch, float yaw, float alt, bool auto_on,float speed,float x,float z,bool recovery_bank) {
+        lock();
+
+        FlightControls& data = seg->data;
+        data.packet_id = id;
+        data.aileron = roll;
+        data.elevator = pitch;
+        data.rudder = yaw;
+        data.altitude = alt;
+        data.autopilot_engaged = auto_on;
+        data.recovery_bank = recovery_bank;
+        data.x = x;
+        data.z = z;
+        data.speed = speed;
+        data.timestamp = std::chrono::steady_clock::now(); // CLOCK_MONOTONIC, confrontabile anche dall'altro processo
+
+        if (seg->new_data_available) seg->lost++;
+        seg->new_data_available = true;
+        pthread_cond_signal(&seg->cv);
+        pthread_mutex_unlock(&seg->mtx);
+    }
+
+    // timeout_ms < 0 aspetta senza limite: si esce solo con un dato nuovo o quando il pilota chiude
+    bool read_with_timeout(FlightControls& final_data, int timeout_ms) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        lock();
+        while (!seg->new_data_available && !seg->writer_closed.load()) {
+            int ret = (timeout_ms < 0) ? pthread_cond_wait(&seg->cv, &seg->mtx)
+                                       : pthread_cond_timedwait(&seg->cv, &seg->mtx, &deadline);
+            if (ret == EOWNERDEAD) pthread_mutex_consistent(&seg->mtx);
+            else if (ret == ETIMEDOUT) break;
+        }
+
+        bool ok = seg->new_data_available;
+        if (ok) {
+            final_data = seg->data;
+            seg->new_data_available = false;
+        }
+        pthread_mutex_unlock(&seg->mtx);
+
+        if (ok) stats.record(final_data.timestamp);
+        return ok;
+    }
+
+    size_t read_batch(FlightControls* out, size_t max, int timeout_ms) {
+        return (max > 0 && read_with_timeout(out[0], timeout_ms)) ? 1 : 0;
+    }
+
+    // il pilota avvisa il computer di volo che non arriveranno altri dati
+    void close_writer() {
+        lock();
+        seg->writer_closed.store(true);
+        pthread_cond_broadcast(&seg->cv);
+        pthread_mutex_unlock(&seg->mtx);
+    }
+
+    // stesso nome degli altri bus
+    void shutdown() { close_writer(); }
+
+    // lato lettore: true se FlightSim è morto o il nome punta ormai a un segmento nuovo (FlightSim ripartito,
+    // shm_unlink del vecchio e nuova creazione). Il segmento mappato resta quello vecchio, va riaperto
+    bool replaced() const {
+        if (seg == nullptr || owner) return false;
+        if (!creator_alive()) return true;
+        int fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+        if (fd < 0) return false; // il vecchio è stato tolto e il nuovo non c'è ancora
+        bool recreated = false;
+        struct stat st;
+        if (fstat(fd, &st) == 0) {
+            if (st.st_size < (off_t) sizeof(ShmBusSegment)) {
+                recreated = true; // appena creato, il vecchio era già lungo abbastanza
+            } else {
+                void* p = mmap(nullptr, sizeof(ShmBusSegment), PROT_READ, MAP_SHARED, fd, 0);
+                if (p != MAP_FAILED) {
+                    recreated = static_cast<const ShmBusSegment*>(p)->generation != generation;
+                    munmap(p, sizeof(ShmBusSegment));
+                }
+            }
+        }
+        close(fd);
+        return recreated;
+    }
+
+    bool writer_closed() const { return seg == nullptr || seg->writer_closed.load(); }
+    long overwritten() const { return seg ? seg->lost : 0; }
+    const BusLatencyStats& latency() const { return stats; }
+};
+
+#endif
@@ -0,0 +1,120 @@
+//funzioni comuni per mettere un thread su un core isolato e dargli priorità real-time
+#ifndef RT_THREAD_HPP
+#define RT_THREAD_HPP
+
+#include <pthread.h>
+#include <sched.h>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <time.h>
+
+// core < 0 lascia l'affinità com'è, priority <= 0 lascia SCHED_OTHER
+// restituisce false se il kernel rifiuta (di solito serve sudo per SCHED_FIFO)
+inline bool pin_current_thread(int core, int priority) {
+    bool ok = true;
+
+    if (core >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(core, &cpuset);
+        int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+        if (ret != 0) {
+            std::fprintf(stderr, "Affinita' sul core %d fallita: %s\n", core, std::strerror(ret));
+            ok = false;
+        }
+    }
+
+    if (priority > 0) {
+        struct sched_param param;
+        param.sched_priority = priority;
+        int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if (ret != 0) {
+            std::fprintf(stderr, "SCHED_FIFO prio %d fallito: %s (serve sudo)\n", priority, std::strerror(ret));
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+#ifndef SCHED_DEADLINE
+#define SCHED_DEADLINE  6
+#endif
+
+// stessa struct sched_attr dei test EDF, con un altro nome perché le glibc recenti la dichiarano già
+struct fbw_sched_attr {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+};
+
+// SCHED_DEADLINE sul thread corrente (runtime <= deadline <= period, in microsecondi)
+// l'affinità va messa prima, con pin_current_thread(core, 0): il kernel accetta DEADLINE solo
+// se il thread può girare su tutti i core del suo root domain, quindi serve un cpuset/isolcpus dedicato
+inline bool set_deadline_current_thread(long runtime_us, long deadline_us, long period_us) {
+    struct fbw_sched_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.sched_policy = SCHED_DEADLINE;
+    attr.sched_runtime = (uint64_t) runtime_us * 1000;
+    attr.sched_deadline = (uint64_t) deadline_us * 1000;
+    attr.sched_period = (uint64_t) period_us * 1000;
+
+    if (syscall(__NR_sched_setattr, 0, &attr, 0) != 0) {
+        std::perror("SCHED_DEADLINE fallito (serve sudo)");
+        return false;
+    }
+    return true;
+}
+
+inline void timespec_add_ns(struct timespec* t, long ns) {
+    t->tv_sec += ns / 1000000000L;
+    t->tv_nsec += ns % 1000000000L;
+    if (t->tv_nsec >= 1000000000L) {
+        t->tv_sec++;
+        t->tv_nsec -= 1000000000L;
+    }
+}
+
+inline long timespec_diff_ns(const struct timespec& start, const struct timespec& end) {
+    return (end.tv_sec - start.tv_sec) * 1000000000L + (end.tv_nsec - start.tv_nsec);
+}
+
+// Tempi di un loop periodico: quanto dura ogni passo e di quanto il risveglio arriva in ritardo
+// rispetto all'attivazione programmata. Solo somme e massimi, niente allocazioni nel thread RT
+struct PeriodicStats {
+    long steps = 0;
+    long overruns = 0;   // passi finiti dopo l'attivazione successiva
+    double sum_exec_us = 0.0;
+    double max_exec_us = 0.0;
+    double sum_jitter_us = 0.0;
+    double max_jitter_us = 0.0;
+
+    void record(long exec_ns, long jitter_ns, long period_ns) {
+        double exec_us = exec_ns / 1000.0;
+        double jitter_us = jitter_ns / 1000.0;
+        steps++;
+        sum_exec_us += exec_us;
+        sum_jitter_us += jitter_us;
+        if (exec_us > max_exec_us) max_exec_us = exec_us;
+        if (jitter_us > max_jitter_us) max_jitter_us = jitter_us;
+        if (jitter_ns + exec_ns > period_ns) overruns++;
+    }
+
+    void print(const char* name, long period_us) const {
+        if (steps == 0) return;
+        std::printf("[%s] passi: %ld (periodo %ld us) | esecuzione media %.2f us max %.2f us"
+                    " | jitter risveglio medio %.2f us max %.2f us | overrun: %ld\n",
+                    name, steps, period_us, sum_exec_us / steps, max_exec_us,
+                    sum_jitter_us / steps, max_jitter_us, overruns);
+    }
+};
+
+#endif
@@ -0,0 +1,136 @@
+//controllo della sequenza dei packet_id di un writer: una finestra scorrevole di WINDOW bit (un bit per numero di
+//sequenza, indicizzata in modo circolare) dice quali numeri recenti sono arrivati. Così si distinguono:
+//  perse          buchi usciti dalla finestra senza che il campione sia arrivato
+//  in attesa      buchi ancora dentro la finestra (possono arrivare in ritardo)
+//  duplicati      numeri già visti
+//  fuori ordine   numeri più vecchi dell'ultimo che riempiono un buco
+//  troppo vecchi  numeri più vecchi di tutta la finestra: non si sa più se sono duplicati o ritardi
+//Memoria fissa (WINDOW / 8 byte più i contatori), costo per campione limitato da WINDOW e O(1) ammortizzato:
+//ogni numero di sequenza entra ed esce dalla finestra una volta sola. packet_id a 32 bit: il giro dopo 4294967295
+//si gestisce con la differenza con segno fra il numero arrivato e l'ultimo (ahead), senza casi speciali.
+//I buchi non dicono dove si è perso il campione: contano tutta la catena dal bus del pilota al reader DDS
+#ifndef SEQUENCE_TRACKER_HPP
+#define SEQUENCE_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+class SequenceTracker {
+public:
+    static constexpr uint32_t WINDOW = 512;
+
+private:
+    static constexpr uint32_t WORDS = WINDOW / 64;
+    uint64_t bits[WORDS];
+    uint32_t last = 0;    // numero di sequenza più alto visto
+    bool started = false;
+
+    bool test(uint32_t seq) const { return (bits[(seq % WINDOW) / 64] >> (seq % 64)) & 1; }
+    void set(uint32_t seq) { bits[(seq % WINDOW) / 64] |= 1ULL << (seq % 64); }
+    void clear(uint32_t seq) { bits[(seq % WINDOW) / 64] &= ~(1ULL << (seq % 64)); }
+
+public:
+    long received = 0;    // campioni diversi arrivati
+    long lost = 0;
+    long pending = 0;     // buchi dentro la finestra
+    long duplicates = 0;
+    long reordered = 0;
+    long stale = 0;
+
+    // all'avvio tutta la finestra conta come arrivata: quello che esce prima del primo campione non è perso
+    SequenceTracker() {
+        for (uint64_t& w : bits) w = ~0ULL;
+    }
+
+    // il writer non c'è più: i buchi ancora aperti non si riempiranno, passano fra le perse
+    void close() {
+        lost += pending;
+        pending = 0;
+    }
+
+    void record(uint32_t seq) {
+        if (!started) {
+            started = true;
+            last = seq;
+            received++;
+            return;
+        }
+        int32_t ahead = (int32_t) (seq - last);
+        if (ahead > 0) {
+            if ((uint32_t) ahead >= WINDOW) {
+                // salto più lungo della finestra: tutti i buchi vecchi sono persi, la finestra riparte vuota
+                lost += pending + (ahead - (int32_t) WINDOW);
+                for (uint64_t& w : bits) w = 0;
+                pending = WINDOW - 1;
+            } else {
+                // i numeri saltati entrano come buchi, quelli che escono dalla finestra ancora vuoti sono persi
+                for (uint32_t s = last + 1; s != seq; s++) {
+                    if (!test(s)) {
+                        lost++;
+                        pending--;
+                    }
+                    clear(s);
+                    pending++;
+                }
+                if (!test(seq)) {
+                    lost++;
+                    pending--;
+                }
+            }
+            set(seq);
+            last = seq;
+            received++;
+        } else if (ahead == 0) {
+            duplicates++;
+        } else if ((uint32_t) -ahead >= WINDOW) {
+            stale++;
+        } else if (test(seq)) {
+            duplicates++;
+        } else {
+            set(seq);
+            pending--;
+            reordered++;
+            received++;
+        }
+    }
+};
+
+// somma dei contatori di più writer (per esempio tutti quelli di un aereo, o tutta la flotta)
+struct SequenceTotals {
+    long received = 0;
+    long lost = 0;
+    long pending = 0;
+    long duplicates = 0;
+    long reordered = 0;
+    long stale = 0;
+    size_t writers = 0;
+
+    // live: il writer è ancora collegato e conta in writers
+    void add(const SequenceTracker& t, bool live = true) {
+        received += t.received;
+        lost += t.lost;
+        pending += t.pending;
+        duplicates += t.duplicates;
+        reordered += t.reordered;
+        stale += t.stale;
+        if (live) writers++;
+    }
+
+    void add(const SequenceTotals& t) {
+        received += t.received;
+        lost += t.lost;
+        pending += t.pending;
+        duplicates += t.duplicates;
+        reordered += t.reordered;
+        stale += t.stale;
+        writers += t.writers;
+    }
+
+    // perse più buchi ancora aperti sul totale atteso, in percentuale
+    double loss_percent() const {
+        long expected = received + lost + pending;
+        return expected > 0 ? (lost + pending) * 100.0 / expected : 0.0;
+    }
+};
+
+#endif
@@ -3,8 +3,21 @@
 #define SHARED_MEMORY_HPP
 
 #include <mutex>
-#include <condition_variable>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <type_traits>
+#include <climits>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <errno.h>
+#include <cstdlib>
 
 // Struttura dati
 struct FlightControls {
@@ -21,45 +34,569 @@ struct FlightControls {
     bool recovery_bank;
 };
 
+// Latenza scrittura -> lettura calcolata dal timestamp messo nella write()
+// la aggiorna solo il thread che legge quindi non serve nessun lock
+struct BusLatencyStats {
+    long samples = 0;
+    double sum_us = 0.0;
+    double max_us = 0.0;
+
+    void record(std::chrono::steady_clock::time_point written) {
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - written).count();
+        samples++;
+        sum_us += us;
+        if (us > max_us) max_us = us;
+    }
+
+    double avg_us() const { return samples > 0 ? sum_us / samples : 0.0; }
+
+    void print(const char* name) const {
+        std::printf("[BUS %s] campioni: %ld | latenza media: %.2f us | max: %.2f us\n",
+                    name, samples, avg_us(), max_us);
+    }
+};
+
+// Evento su futex: ogni notify incrementa il contatore e sveglia chi dorme, chi aspetta resta nel kernel
+// finché il contatore non cambia. Il writer fa la syscall solo se c'è davvero qualcuno che aspetta
+class FutexEvent {
+    std::atomic<uint32_t> word{0};
+    std::atomic<uint32_t> waiters{0};
+
+    uint32_t* addr() { return reinterpret_cast<uint32_t*>(&word); }
+
+public:
+    uint32_t value() const { return word.load(); }
+
+    void notify_all() {
+        word.fetch_add(1);
+        if (waiters.load() > 0) syscall(SYS_futex, addr(), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+
+    // Aspetta che il contatore sia diverso da expected; timeout_ms < 0 = nessun timeout
+    // false solo se scade il timeout
+    bool wait(uint32_t expected, int timeout_ms) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        waiters.fetch_add(1);
+        bool changed = true;
+        while (word.load() == expected) {
+            struct timespec rel;
+            struct timespec* prel = nullptr;
+            if (timeout_ms >= 0) {
+                auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - std::chrono::steady_clock::now()).count();
+                if (left <= 0) {
+                    changed = false;
+                    break;
+                }
+                rel.tv_sec = left / 1000000000L;
+                rel.tv_nsec = left % 1000000000L;
+                prel = &rel;
+            }
+            // il kernel controlla di nuovo word == expected prima di addormentarci, niente wakeup perso
+            syscall(SYS_futex, addr(), FUTEX_WAIT_PRIVATE, expected, prel, nullptr, 0);
+        }
+        waiters.fetch_sub(1);
+        return changed;
+    }
+};
+
+// Protocollo del mutex del bus: con i thread SCHED_FIFO un mutex normale permette inversioni di priorità
+// senza limite (un thread a priorità media blocca chi tiene il lock e quindi anche il lettore ad alta priorità)
+enum class BusLockPolicy {
+    DEFAULT,    // PTHREAD_PRIO_NONE, come std::mutex
+    INHERIT,    // PTHREAD_PRIO_INHERIT: chi tiene il lock eredita la priorità di chi aspetta
+    PROTECT     // PTHREAD_PRIO_PROTECT: chi tiene il lock sale subito alla priority ceiling
+};
+
+inline const char* lock_policy_name(BusLockPolicy policy) {
+    switch (policy) {
+        case BusLockPolicy::INHERIT: return "PRIO_INHERIT";
+        case BusLockPolicy::PROTECT: return "PRIO_PROTECT";
+        default: return "PRIO_NONE";
+    }
+}
+
+// Mutex pthread con protocollo scelto, usabile con std::unique_lock
+// ATTENZIONE: con PRIO_PROTECT glibc rifiuta il lock (EINVAL) ai thread SCHED_OTHER, quindi chi usa il bus
+// deve girare SCHED_FIFO/SCHED_RR con priorità <= ceiling
+class RtMutex {
+    pthread_mutex_t mtx;
+    BusLockPolicy policy;
+
+    bool init(BusLockPolicy p, int ceiling) {
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        if (p == BusLockPolicy::INHERIT) {
+            pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+        } else if (p == BusLockPolicy::PROTECT) {
+            pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_PROTECT);
+            pthread_mutexattr_setprioceiling(&attr, ceiling);
+        }
+        int ret = pthread_mutex_init(&mtx, &attr);
+        pthread_mutexattr_destroy(&attr);
+        policy = p;
+        return ret == 0;
+    }
+
+public:
+    explicit RtMutex(BusLockPolicy p = BusLockPolicy::DEFAULT, int ceiling = 99) {
+        if (!init(p, ceiling)) {
+            std::fprintf(stderr, "Mutex %s non supportato, uso PRIO_NONE\n", lock_policy_name(p));
+            init(BusLockPolicy::DEFAULT, 0);
+        }
+    }
+    ~RtMutex() { pthread_mutex_destroy(&mtx); }
+
+    RtMutex(const RtMutex&) = delete;
+    RtMutex& operator=(const RtMutex&) = delete;
+
+    void lock() {
+        int ret = pthread_mutex_lock(&mtx);
+        if (ret != 0) {
+            // senza lock il bus non è più protetto: meglio fermarsi subito che volare con dati corrotti
+            std::fprintf(stderr, "Lock %s fallito: %s (con PRIO_PROTECT servono thread SCHED_FIFO)\n",
+                         lock_policy_name(policy), std::strerror(ret));
+            std::abort();
+        }
+    }
+    void unlock() { pthread_mutex_unlock(&mtx); }
+    pthread_mutex_t* native_handle() { return &mtx; }
+};
+
 class SharedMemoryBus {
     FlightControls data;
-    std::mutex mtx;
-    std::condition_variable cv;
+    RtMutex mtx;
+    pthread_cond_t cv;
     bool new_data_available = false;
+    bool shutdown_requested = false;
+    long lost = 0; // campioni sovrascritti prima che il computer di volo li leggesse
+    BusLatencyStats stats;
 
 public:
+    static constexpr const char* name = "MUTEX";
+
+    explicit SharedMemoryBus(BusLockPolicy policy = BusLockPolicy::DEFAULT, int ceiling = 99) : mtx(policy, ceiling) {
+        // CLOCK_MONOTONIC come steady_clock per i timeout
+        pthread_condattr_t cattr;
+        pthread_condattr_init(&cattr);
+        pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+        pthread_cond_init(&cv, &cattr);
+        pthread_condattr_destroy(&cattr);
+    }
+    ~SharedMemoryBus() { pthread_cond_destroy(&cv); }
+
+    // Scrittura generica: fill riempie il frame dentro la sezione critica, il timestamp lo mette il bus
+    template <typename Fill>
+    void update(Fill&& fill) {
+        std::unique_lock<RtMutex> lock(mtx);
+
+        fill(data);
+        data.timestamp = std::chrono::steady_clock::now();
+
+        if (new_data_available) lost++;
+        new_data_available = true;
+        pthread_cond_signal(&cv); // Sveglia il thread del Computer di Volo
+    }
+
     // Funzione di scrittura aggiornata con 7 parametri tutti messi nella struct FlightControls
     void write(long id, float roll, float pitch, float yaw, float alt, bool auto_on,float speed,float x,float z,bool recovery_bank) {
-        std::unique_lock<std::mutex> lock(mtx);
-        
+        update([&](FlightControls& d) {
+            d.packet_id = id;
+            d.aileron = roll;
+            d.elevator = pitch;
+            d.rudder = yaw;
+            d.altitude = alt;            // Salviamo l'altitudine
+            d.autopilot_engaged = auto_on; // Salviamo lo stato dell'autopilota
+            d.recovery_bank= recovery_bank;//controlliamo lo stato di roll
+            d.x=x;
+            d.z=z;
+            d.speed=speed;
+        });
+    }
+
+    // Funzione di lettura copia tutta la struct usata
+    // timeout_ms < 0 aspetta senza limite: si esce solo con un dato nuovo o con shutdown()
+    bool read_with_timeout(FlightControls& final_data, int timeout_ms) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += timeout_ms / 1000;
+        deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        std::unique_lock<RtMutex> lock(mtx);
+        // Aspetta finché non ci sono dati o scade il tempo
+        while (!new_data_available && !shutdown_requested) {
+            if (timeout_ms < 0) pthread_cond_wait(&cv, mtx.native_handle());
+            else if (pthread_cond_timedwait(&cv, mtx.native_handle(), &deadline) == ETIMEDOUT) break;
+        }
+
+        if (!new_data_available) return false; // timeout o svegliati dallo shutdown
+        final_data = data;
+        new_data_available = false;
+        stats.record(final_data.timestamp);
+        return true;
+    }
+
+    // Sveglia il lettore e gli dice che non arriveranno altri dati
+    void shutdown() {
+        std::lock_guard<RtMutex> lock(mtx);
+        shutdown_requested = true;
+        pthread_cond_broadcast(&cv);
+    }
+
+    // Con un solo slot il batch è al massimo di un campione
+    size_t read_batch(FlightControls* out, size_t max, int timeout_ms) {
+        return (max > 0 && read_with_timeout(out[0], timeout_ms)) ? 1 : 0;
+    }
+
+    const BusLatencyStats& latency() const { return stats; }
+    long overwritten() const { return lost; }
+};
+
+// Seqlock generico: un solo scrittore che non aspetta mai, i lettori riprovano se la copia è stata
+// sovrascritta a metà. Il dato è salvato in parole atomiche da 64 bit così la copia è sempre ben definita
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock richiede un tipo copiabile con memcpy");
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> seq{0}; // dispari = scrittura in corso
+    std::atomic<uint64_t> words[WORDS] = {};
+
+public:
+    // Solo uno scrittore alla volta
+    void store(const T& value) {
+        uint64_t buf[WORDS] = {};
+        std::memcpy(buf, &value, sizeof(T));
+
+        uint64_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++) words[i].store(buf[i], std::memory_order_relaxed);
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    // Restituisce false se lo scrittore ci ha interrotto, in out_seq la versione letta
+    bool try_load(T& out, uint64_t& out_seq) const {
+        uint64_t s1 = seq.load(std::memory_order_acquire);
+        if (s1 & 1) return false;
+
+        uint64_t buf[WORDS];
+        for (size_t i = 0; i < WORDS; i++) buf[i] = words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (seq.load(std::memory_order_relaxed) != s1) return false;
+        std::memcpy(&out, buf, sizeof(T));
+        out_seq = s1;
+        return true;
+    }
+
+    uint64_t sequence() const { return seq.load(std::memory_order_acquire); }
+};
+
+// Stessa interfaccia di SharedMemoryBus ma senza mutex: il thread di render non può mai essere bloccato
+// dal thread DDS, e il lettore vede sempre l'ultimo valore scritto (i campioni intermedi si perdono come prima)
+class SeqLockBus {
+    SeqLock<FlightControls> slot;
+    FutexEvent event;                     // sveglia il lettore a ogni write e allo shutdown
+    std::atomic<bool> stop{false};
+    uint64_t last_seq = 0; // ultima versione consumata, la usa solo il lettore
+    BusLatencyStats stats;
+
+public:
+    static constexpr const char* name = "SEQLOCK";
+
+    void write(long id, float roll, float pitch, float yaw, float alt, bool auto_on,float speed,float x,float z,bool recovery_bank) {
+        FlightControls data{};
         data.packet_id = id;
         data.aileron = roll;
         data.elevator = pitch;
         data.rudder = yaw;
-        data.altitude = alt;            // Salviamo l'altitudine
-        data.autopilot_engaged = auto_on; // Salviamo lo stato dell'autopilota
-        data.recovery_bank= recovery_bank;//controlliamo lo stato di roll
-        data.x=x;
-        data.z=z;
-        data.speed=speed;
+        data.altitude = alt;
+        data.autopilot_engaged = auto_on;
+        data.recovery_bank = recovery_bank;
+        data.x = x;
+        data.z = z;
+        data.speed = speed;
         data.timestamp = std::chrono::steady_clock::now();
-        
-        new_data_available = true;
-        cv.notify_one(); // Sveglia il thread del Computer di Volo
+
+        slot.store(data);
+        event.notify_all();
     }
 
-    // Funzione di lettura copia tutta la struct usata
+    // timeout_ms < 0 aspetta senza limite: si esce solo con un dato nuovo o con shutdown()
     bool read_with_timeout(FlightControls& final_data, int timeout_ms) {
-        std::unique_lock<std::mutex> lock(mtx);
-        // Aspetta finché non ci sono dati o scade il tempo
-        if(cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]{
-        	return new_data_available;
-        })) {
-            final_data = data;
-            new_data_available = false;
-            return true;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+        while (true) {
+            uint32_t ev = event.value(); // letto prima del dato così non perdo una write che arriva ora
+            uint64_t s;
+            if (slot.sequence() != last_seq && slot.try_load(final_data, s)) {
+                last_seq = s;
+                stats.record(final_data.timestamp);
+                return true;
+            }
+            if (stop.load()) return false;
+
+            int left_ms = -1;
+            if (timeout_ms >= 0) {
+                left_ms = (int) std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                if (left_ms <= 0) return false;
+            }
+            event.wait(ev, left_ms);
+        }
+    }
+
+    void shutdown() {
+        stop.store(true);
+        event.notify_all();
+    }
+
+    size_t read_batch(FlightControls* out, size_t max, int timeout_ms) {
+        return (max > 0 && read_with_timeout(out[0], timeout_ms)) ? 1 : 0;
+    }
+
+    const BusLatencyStats& latency() const { return stats; }
+};
+
+// Coda circolare single-producer/single-consumer: a differenza dei bus sopra non perde nessun frame
+// finché il computer di volo tiene il passo. Se la coda è piena il frame nuovo viene scartato e contato,
+// il thread di render non si blocca mai. CAPACITY deve essere una potenza di due per usare la maschera
+template <size_t CAPACITY>
+class SpscRingBus {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY deve essere una potenza di due");
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    // head e tail su linee di cache diverse per non farle rimbalzare tra i due core
+    alignas(64) std::atomic<size_t> head{0};    // prossimo slot da scrivere (solo produttore)
+    alignas(64) std::atomic<size_t> tail{0};    // prossimo slot da leggere (solo consumatore)
+    alignas(64) std::atomic<long> overruns{0};  // frame scartati a coda piena
+    std::atomic<size_t> high_water{0};          // massima profondità vista dal produttore
+    alignas(64) BusLatencyStats stats;          // tempo passato in coda, lo aggiorna il consumatore
+    FutexEvent event;                           // sveglia il consumatore a ogni write e allo shutdown
+    std::atomic<bool> stop{false};
+    FlightControls slots[CAPACITY];
+
+public:
+    static constexpr const char* name = "SPSC_RING";
+
+    void write(long id, float roll, float pitch, float yaw, float alt, bool auto_on,float speed,float x,float z,bool recovery_bank) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t depth = h - tail.load(std::memory_order_acquire);
+        if (depth >= CAPACITY) {
+            overruns.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        FlightControls& data = slots[h & MASK];
+        data.packet_id = id;
+        data.aileron = roll;
+        data.elevator = pitch;
+        data.rudder = yaw;
+        data.altitude = alt;
+        data.autopilot_engaged = auto_on;
+        data.recovery_bank = recovery_bank;
+        data.x = x;
+        data.z = z;
+        data.speed = speed;
+        data.timestamp = std::chrono::steady_clock::now();
+
+        head.store(h + 1, std::memory_order_release);
+        event.notify_all();
+        if (depth + 1 > high_water.load(std::memory_order_relaxed))
+            high_water.store(depth + 1, std::memory_order_relaxed);
+    }
+
+    // Svuota fino a max frame in una volta, aspetta al massimo timeout_ms se la coda è vuota
+    // (timeout_ms < 0 = senza limite). Restituisce 0 solo per timeout o shutdown a coda vuota
+    size_t read_batch(FlightControls* out, size_t max, int timeout_ms) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        size_t t = tail.load(std::memory_order_relaxed);
+
+        while (true) {
+            uint32_t ev = event.value();
+            size_t available = head.load(std::memory_order_acquire) - t;
+            if (available > 0) {
+                size_t n = available < max ? available : max;
+                for (size_t i = 0; i < n; i++) {
+                    out[i] = slots[(t + i) & MASK];
+                    stats.record(out[i].timestamp);
+                }
+                tail.store(t + n, std::memory_order_release);
+                return n;
+            }
+            if (stop.load()) return 0;
+
+            int left_ms = -1;
+            if (timeout_ms >= 0) {
+                left_ms = (int) std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                if (left_ms <= 0) return 0;
+            }
+            event.wait(ev, left_ms);
+        }
+    }
+
+    void shutdown() {
+        stop.store(true);
+        event.notify_all();
+    }
+
+    bool read_with_timeout(FlightControls& final_data, int timeout_ms) {
+        return read_batch(&final_data, 1, timeout_ms) == 1;
+    }
+
+    size_t depth() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+    long overrun_count() const { return overruns.load(std::memory_order_relaxed); }
+    size_t high_water_mark() const { return high_water.load(std::memory_order_relaxed); }
+    const BusLatencyStats& latency() const { return stats; }
+
+    void print_counters() const {
+        std::printf("[BUS %s] capacita': %zu | overrun: %ld | high-water: %zu | ritardo in coda medio: %.2f us max: %.2f us\n",
+                    name, CAPACITY, overrun_count(), high_water_mark(), stats.avg_us(), stats.max_us);
+    }
+};
+
+// Bus broadcast stile disruptor: uno scrittore e tanti lettori (computer di volo DDS, flight recorder,
+// health monitor...) che vedono tutti ogni campione. Ogni lettore ha il suo cursore, lo scrittore non
+// aspetta mai nessuno: se un lettore resta indietro di più di CAPACITY campioni viene "doppiato",
+// salta al campione più vecchio ancora valido e i campioni persi vengono contati
+template <size_t CAPACITY>
+class BroadcastBus {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY deve essere una potenza di due");
+    static constexpr size_t MASK = CAPACITY - 1;
+    static constexpr size_t WORDS = (sizeof(FlightControls) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    // ogni slot ha la sua versione: 2n+1 mentre scrivo il campione n, 2n+2 quando è pronto
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> version{0};
+        std::atomic<uint64_t> words[WORDS] = {};
+    };
+
+    alignas(64) std::atomic<uint64_t> published{0}; // campioni scritti finora
+    FutexEvent event;
+    std::atomic<bool> stop{false};
+    Slot slots[CAPACITY];
+
+public:
+    static constexpr const char* name = "BROADCAST";
+
+    class Consumer {
+        BroadcastBus* bus;
+        const char* consumer_name;
+        uint64_t cursor;        // prossimo campione da leggere
+        long received = 0;
+        long lost = 0;          // campioni sovrascritti prima che li leggessi
+        long lapped = 0;        // quante volte sono stato doppiato dallo scrittore
+        BusLatencyStats stats;
+
+        // salto al campione più vecchio che lo scrittore non sta sovrascrivendo
+        // (lo scrittore può essere a metà del campione head, che usa lo slot di head - CAPACITY)
+        void catch_up(uint64_t head) {
+            uint64_t oldest = head + 1 - CAPACITY;
+            lost += (long) (oldest - cursor);
+            lapped++;
+            cursor = oldest;
+        }
+
+    public:
+        Consumer(BroadcastBus* b, const char* n) : bus(b), consumer_name(n), cursor(b->published.load()) {}
+
+        // timeout_ms < 0 = senza limite; 0 solo per timeout o shutdown senza campioni da leggere
+        size_t read_batch(FlightControls* out, size_t max, int timeout_ms) {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+            while (true) {
+                uint32_t ev = bus->event.value();
+                size_t n = 0;
+
+                while (n < max) {
+                    uint64_t head = bus->published.load(std::memory_order_acquire);
+                    if (cursor == head) break;
+                    if (head - cursor >= CAPACITY) {
+                        catch_up(head);
+                        continue;
+                    }
+
+                    // se la versione non torna lo scrittore è già passato oltre: ricarico head e mi riallineo
+                    const Slot& slot = bus->slots[cursor & MASK];
+                    uint64_t expected = 2 * cursor + 2;
+                    if (slot.version.load(std::memory_order_acquire) != expected) continue;
+                    uint64_t buf[WORDS];
+                    for (size_t i = 0; i < WORDS; i++) buf[i] = slot.words[i].load(std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (slot.version.load(std::memory_order_relaxed) != expected) continue; // sovrascritto mentre lo copiavo
+
+                    std::memcpy(&out[n], buf, sizeof(FlightControls));
+                    stats.record(out[n].timestamp);
+                    cursor++;
+                    n++;
+                }
+
+                if (n > 0) {
+                    received += (long) n;
+                    return n;
+                }
+                if (bus->stop.load()) return 0;
+
+                int left_ms = -1;
+                if (timeout_ms >= 0) {
+                    left_ms = (int) std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                    if (left_ms <= 0) return 0;
+                }
+                bus->event.wait(ev, left_ms);
+            }
+        }
+
+        bool read_with_timeout(FlightControls& final_data, int timeout_ms) {
+            return read_batch(&final_data, 1, timeout_ms) == 1;
+        }
+
+        long lost_count() const { return lost; }
+        long lapped_count() const { return lapped; }
+        const BusLatencyStats& latency() const { return stats; }
+
+        void print_counters() const {
+            std::printf("[BUS %s/%s] ricevuti: %ld | persi: %ld | doppiato: %ld volte | latenza media: %.2f us max: %.2f us\n",
+                        name, consumer_name, received, lost, lapped, stats.avg_us(), stats.max_us);
         }
-        return false;
+    };
+
+    // Nuovo lettore: parte dal prossimo campione che verrà scritto
+    Consumer subscribe(const char* consumer_name) { return Consumer(this, consumer_name); }
+
+    void write(long id, float roll, float pitch, float yaw, float alt, bool auto_on,float speed,float x,float z,bool recovery_bank) {
+        FlightControls data{};
+        data.packet_id = id;
+        data.aileron = roll;
+        data.elevator = pitch;
+        data.rudder = yaw;
+        data.altitude = alt;
+        data.autopilot_engaged = auto_on;
+        data.recovery_bank = recovery_bank;
+        data.x = x;
+        data.z = z;
+        data.speed = speed;
+        data.timestamp = std::chrono::steady_clock::now();
+
+        uint64_t buf[WORDS] = {};
+        std::memcpy(buf, &data, sizeof(FlightControls));
+
+        uint64_t n = published.load(std::memory_order_relaxed);
+        Slot& slot = slots[n & MASK];
+        slot.version.store(2 * n + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++) slot.words[i].store(buf[i], std::memory_order_relaxed);
+        slot.version.store(2 * n + 2, std::memory_order_release);
+        published.store(n + 1, std::memory_order_release);
+
+        event.notify_all();
+    }
+
+    void shutdown() {
+        stop.store(true);
+        event.notify_all();
     }
 };
 
@@ -0,0 +1,44 @@
+//coda circolare generica un produttore / un consumatore senza lock e senza attese:
+//il produttore (thread real-time) non si blocca mai, a coda piena try_push restituisce false
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+template <typename T, size_t CAPACITY>
+class SpscQueue {
+    static_assert(CAPACITY >= 2 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY deve essere una potenza di due");
+    static constexpr size_t MASK = CAPACITY - 1;
+
+    // head e tail su linee di cache diverse, come in SpscRingBus
+    alignas(64) std::atomic<size_t> head{0}; // prossimo slot da scrivere (solo produttore)
+    alignas(64) std::atomic<size_t> tail{0}; // prossimo slot da leggere (solo consumatore)
+    alignas(64) T slots[CAPACITY];
+
+public:
+    bool try_push(const T& value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= CAPACITY) return false;
+        slots[h & MASK] = value;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // prende fino a max elementi, restituisce quanti
+    size_t pop_batch(T* out, size_t max) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t available = head.load(std::memory_order_acquire) - t;
+        size_t n = available < max ? available : max;
+        for (size_t i = 0; i < n; i++) out[i] = slots[(t + i) & MASK];
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    bool try_pop(T& out) { return pop_batch(&out, 1) == 1; }
+
+    size_t size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+    static constexpr size_t capacity() { return CAPACITY; }
+};
+
+#endif
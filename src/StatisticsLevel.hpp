@@ -0,0 +1,159 @@
+//livello delle statistiche Fast DDS, uguale per FlightSim, FlightComputer e MonitorApp:
+//- off:   nessun DataWriter di statistiche (default, niente costi sul percorso della telemetria)
+//- basic: solo contatori (throughput, HEARTBEAT e ACKNACK), niente calcoli per campione
+//- full:  anche latenza di storia e di rete, dati fisici della macchina e discovery
+//Si sceglie con FBW_STATISTICS=off|basic|full, FlightSim accetta anche --stats; a programma avviato
+//kill -USR1 <pid> passa a full e un altro SIGUSR1 torna indietro (StatisticsSwitch). Le statistiche ci sono solo
+//se Fast DDS è compilato con FASTDDS_STATISTICS, altrimenti narrow() restituisce nullptr e non succede niente.
+//Le legge e le riassume StatsCollector
+#ifndef STATISTICS_LEVEL_HPP
+#define STATISTICS_LEVEL_HPP
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/statistics/dds/domain/DomainParticipant.hpp>
+#include <fastdds/statistics/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/statistics/topic_names.hpp>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <pthread.h>
+#include <string>
+#include <thread>
+
+enum class StatisticsLevel { OFF, BASIC, FULL };
+
+constexpr const char* STATISTICS_LEVEL_ENV = "FBW_STATISTICS";
+
+inline bool parse_statistics_level(const std::string& s, StatisticsLevel& out) {
+    if (s == "off") out = StatisticsLevel::OFF;
+    else if (s == "basic") out = StatisticsLevel::BASIC;
+    else if (s == "full") out = StatisticsLevel::FULL;
+    else return false;
+    return true;
+}
+
+inline const char* statistics_level_name(StatisticsLevel level) {
+    switch (level) {
+        case StatisticsLevel::BASIC: return "basic";
+        case StatisticsLevel::FULL: return "full";
+        default: return "off";
+    }
+}
+
+// FBW_STATISTICS se c'è ed è valida, altrimenti fallback
+inline StatisticsLevel statistics_level_from_env(StatisticsLevel fallback = StatisticsLevel::OFF) {
+    const char* env = std::getenv(STATISTICS_LEVEL_ENV);
+    StatisticsLevel level = fallback;
+    if (env != nullptr) parse_statistics_level(env, level);
+    return level;
+}
+
+// Livello minimo da cui ogni topic di statistiche è acceso
+struct StatisticsTopic {
+    const char* name;
+    StatisticsLevel from;
+};
+
+inline const StatisticsTopic* statistics_topics(size_t& count) {
+    using namespace eprosima::fastdds::statistics;
+    static const StatisticsTopic topics[] = {
+        // contatori: si aggiornano per pacchetto, nessun timestamp per campione
+        { PUBLICATION_THROUGHPUT_TOPIC, StatisticsLevel::BASIC },
+        { SUBSCRIPTION_THROUGHPUT_TOPIC, StatisticsLevel::BASIC },
+        { HEARTBEAT_COUNT_TOPIC, StatisticsLevel::BASIC },
+        { ACKNACK_COUNT_TOPIC, StatisticsLevel::BASIC },
+        // latenze: un calcolo (e un campione di statistica) per ogni campione di telemetria
+        { HISTORY_LATENCY_TOPIC, StatisticsLevel::FULL },
+        { NETWORK_LATENCY_TOPIC, StatisticsLevel::FULL },
+        { PHYSICAL_DATA_TOPIC, StatisticsLevel::FULL },
+        { DISCOVERY_TOPIC, StatisticsLevel::FULL },
+    };
+    count = sizeof(topics) / sizeof(topics[0]);
+    return topics;
+}
+
+// Passa il participant dal livello current al livello wanted accendendo o spegnendo solo i DataWriter che
+// cambiano, si può chiamare anche a programma avviato (per esempio full per qualche minuto di diagnosi).
+// false se Fast DDS non ha le statistiche
+inline bool set_statistics_level(eprosima::fastdds::dds::DomainParticipant* participant,
+                                 StatisticsLevel current, StatisticsLevel wanted) {
+    auto* stat_participant = eprosima::fastdds::statistics::dds::DomainParticipant::narrow(participant);
+    if (stat_participant == nullptr) return wanted == StatisticsLevel::OFF;
+
+    size_t count = 0;
+    const StatisticsTopic* topics = statistics_topics(count);
+    for (size_t i = 0; i < count; i++) {
+        bool was_on = current >= topics[i].from;
+        bool on = wanted >= topics[i].from;
+        if (on && !was_on) {
+            stat_participant->enable_statistics_datawriter(topics[i].name,
+                    eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
+        } else if (!on && was_on) {
+            stat_participant->disable_statistics_datawriter(topics[i].name);
+        }
+    }
+    return true;
+}
+
+// Cambio del livello senza riavviare: ogni SIGUSR1 passa dal livello di partenza a full e viceversa (da full a off),
+// per accendere le latenze solo per qualche minuto di diagnosi. Fast DDS non si può chiamare da un gestore di
+// segnale: SIGUSR1 resta bloccato in tutti i thread e lo prende con sigtimedwait un thread SCHED_OTHER.
+// block_signal() va chiamata all'inizio di main, prima di creare thread e participant (i thread ereditano la
+// maschera), così nessun thread real-time si vede interrompere un clock_nanosleep
+class StatisticsSwitch {
+    eprosima::fastdds::dds::DomainParticipant* participant = nullptr;
+    StatisticsLevel base = StatisticsLevel::OFF;
+    StatisticsLevel current = StatisticsLevel::OFF;
+    std::atomic<bool> stop{false};
+    std::thread worker;
+
+    void run() {
+        // chi ci ha creato poteva essere SCHED_FIFO: il cambio non deve rubare tempo ai thread real-time
+        struct sched_param normal = {};
+        pthread_setschedparam(pthread_self(), SCHED_OTHER, &normal);
+
+        sigset_t set;
+        sigemptyset(&set);
+        sigaddset(&set, SIGUSR1);
+        struct timespec poll = { 0, 200000000 }; // ogni 200 ms guarda se deve uscire
+        while (!stop.load()) {
+            if (sigtimedwait(&set, nullptr, &poll) != SIGUSR1) continue;
+            StatisticsLevel other = base == StatisticsLevel::FULL ? StatisticsLevel::OFF : StatisticsLevel::FULL;
+            StatisticsLevel wanted = current == base ? other : base;
+            if (!set_statistics_level(participant, current, wanted)) {
+                std::printf("[STATS] Fast DDS compilato senza FASTDDS_STATISTICS, niente da cambiare\n");
+                continue;
+            }
+            current = wanted;
+            std::printf("[STATS] statistiche Fast DDS: %s\n", statistics_level_name(current));
+        }
+    }
+
+public:
+    static void block_signal() {
+        sigset_t set;
+        sigemptyset(&set);
+        sigaddset(&set, SIGUSR1);
+        pthread_sigmask(SIG_BLOCK, &set, nullptr);
+    }
+
+    // level è quello già impostato sul participant
+    void start(eprosima::fastdds::dds::DomainParticipant* p, StatisticsLevel level) {
+        if (p == nullptr || worker.joinable()) return;
+        participant = p;
+        base = current = level;
+        worker = std::thread(&StatisticsSwitch::run, this);
+    }
+
+    // prima di cancellare il participant
+    void shutdown() {
+        if (!worker.joinable()) return;
+        stop.store(true);
+        worker.join();
+    }
+
+    ~StatisticsSwitch() { shutdown(); }
+};
+
+#endif
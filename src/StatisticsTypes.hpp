@@ -0,0 +1,318 @@
+//tipi dei topic di statistiche di Fast DDS (types.idl di Fast DDS, modulo eprosima::fastdds::statistics).
+//Fast DDS non installa gli header generati di questi tipi, quindi qui c'è solo il lato che legge, scritto a mano:
+//strutture a dimensione fissa (le stringhe di PhysicalData si troncano) e un TopicDataType che deserializza
+//il CDR senza allocare. Vanno bene XCDR1 e XCDR2, con o senza DHEADER (tipi final o appendable);
+//i tipi mutable (parameter list) non servono e si scartano
+#ifndef STATISTICS_TYPES_HPP
+#define STATISTICS_TYPES_HPP
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+#include <fastdds/utils/md5.hpp>
+#include <cstdint>
+#include <cstring>
+
+// Lettore CDR minimo: allineamento relativo all'inizio dei dati (dopo l'encapsulation), massimo 8 in XCDR1 e 4 in XCDR2
+class StatsCdrReader {
+    const uint8_t* data = nullptr;
+    uint32_t length = 0;
+    uint32_t pos = 4;
+    uint32_t max_align = 8;
+    bool swap = false;      // ordine dei byte diverso da quello della macchina
+    bool delimited = false; // D_CDR2: ogni struttura comincia con la sua lunghezza (DHEADER)
+    bool valid = true;
+
+    void align(uint32_t size) {
+        uint32_t a = size < max_align ? size : max_align;
+        uint32_t offset = (pos - 4) % a;
+        if (offset != 0) pos += a - offset;
+    }
+
+public:
+    bool open(const eprosima::fastdds::rtps::SerializedPayload_t& payload) {
+        data = payload.data;
+        length = payload.length;
+        if (data == nullptr || length < 4) return false;
+        // identificativo di encapsulation (RTPS e XTypes): pari big endian, dispari little endian
+        uint8_t id = data[1];
+        if (id == 0x02 || id == 0x03 || id == 0x0a || id == 0x0b) return false; // parameter list
+        bool little = (id & 1) != 0;
+        swap = little != (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__);
+        max_align = id >= 0x06 ? 4 : 8;
+        delimited = id == 0x08 || id == 0x09;
+        pos = 4;
+        valid = true;
+        return true;
+    }
+
+    bool ok() const { return valid; }
+
+    template <typename T>
+    T read() {
+        T value{};
+        align(sizeof(T));
+        if (pos + sizeof(T) > length) {
+            valid = false;
+            return value;
+        }
+        uint8_t bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); i++) bytes[i] = data[pos + (swap ? sizeof(T) - 1 - i : i)];
+        std::memcpy(&value, bytes, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    void read_octets(uint8_t* out, uint32_t n) {
+        if (pos + n > length) {
+            valid = false;
+            std::memset(out, 0, n);
+            return;
+        }
+        std::memcpy(out, data + pos, n);
+        pos += n;
+    }
+
+    // stringa troncata a capacity - 1 caratteri, il resto si salta
+    void read_string(char* out, uint32_t capacity) {
+        uint32_t n = read<uint32_t>();
+        if (!valid || pos + n > length) {
+            valid = false;
+            out[0] = '\0';
+            return;
+        }
+        uint32_t copy = n > 0 ? n - 1 : 0; // n comprende il terminatore
+        if (copy > capacity - 1) copy = capacity - 1;
+        std::memcpy(out, data + pos, copy);
+        out[copy] = '\0';
+        pos += n;
+    }
+
+    // begin_struct/end_struct intorno a ogni struttura, anche annidata: con il DHEADER si salta quello che
+    // una versione più nuova di Fast DDS aggiunge in coda
+    uint32_t begin_struct() {
+        if (!delimited) return 0;
+        uint32_t size = read<uint32_t>();
+        return pos + size;
+    }
+
+    void end_struct(uint32_t end) {
+        if (!delimited) return;
+        if (end > length) valid = false;
+        else pos = end;
+    }
+};
+
+// detail::GUID_s: GuidPrefix_s (12 ottetti) + EntityId_s (4 ottetti)
+struct StatsGuid {
+    uint8_t value[16];
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t guid_end = cdr.begin_struct();
+        uint32_t end = cdr.begin_struct();
+        cdr.read_octets(value, 12);
+        cdr.end_struct(end);
+        end = cdr.begin_struct();
+        cdr.read_octets(value + 12, 4);
+        cdr.end_struct(end);
+        cdr.end_struct(guid_end);
+    }
+
+    bool same_participant(const StatsGuid& other) const { return std::memcmp(value, other.value, 12) == 0; }
+};
+
+// detail::Locator_s
+struct StatsLocator {
+    int32_t kind;
+    uint32_t port;
+    uint8_t address[16];
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        kind = cdr.read<int32_t>();
+        port = cdr.read<uint32_t>();
+        cdr.read_octets(address, 16);
+        cdr.end_struct(end);
+    }
+
+    // la chiave si serializza big endian (XTypes, key hash)
+    size_t key(uint8_t* out) const {
+        for (int i = 0; i < 4; i++) out[i] = (uint8_t) ((uint32_t) kind >> (24 - 8 * i));
+        for (int i = 0; i < 4; i++) out[4 + i] = (uint8_t) (port >> (24 - 8 * i));
+        std::memcpy(out + 8, address, 16);
+        return 24;
+    }
+};
+
+// HISTORY_LATENCY: latenza dalla write alla notifica al lettore, in nanosecondi
+struct StatsWriterReaderData {
+    static constexpr const char* TYPE_NAME = "eprosima::fastdds::statistics::WriterReaderData";
+    static constexpr uint32_t KEY_MAX_SIZE = 32;
+    StatsGuid writer_guid;
+    StatsGuid reader_guid;
+    float data;
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        writer_guid.read(cdr);
+        reader_guid.read(cdr);
+        data = cdr.read<float>();
+        cdr.end_struct(end);
+    }
+
+    size_t key(uint8_t* out) const {
+        std::memcpy(out, writer_guid.value, 16);
+        std::memcpy(out + 16, reader_guid.value, 16);
+        return 32;
+    }
+};
+
+// NETWORK_LATENCY: latenza fra due locator (chi spedisce, chi riceve), in nanosecondi
+struct StatsLocator2LocatorData {
+    static constexpr const char* TYPE_NAME = "eprosima::fastdds::statistics::Locator2LocatorData";
+    static constexpr uint32_t KEY_MAX_SIZE = 48;
+    StatsLocator src_locator;
+    StatsLocator dst_locator;
+    float data;
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        src_locator.read(cdr);
+        dst_locator.read(cdr);
+        data = cdr.read<float>();
+        cdr.end_struct(end);
+    }
+
+    size_t key(uint8_t* out) const { return src_locator.key(out) + dst_locator.key(out + 24); }
+};
+
+// PUBLICATION_THROUGHPUT e SUBSCRIPTION_THROUGHPUT: byte al secondo del writer o del reader
+struct StatsEntityData {
+    static constexpr const char* TYPE_NAME = "eprosima::fastdds::statistics::EntityData";
+    static constexpr uint32_t KEY_MAX_SIZE = 16;
+    StatsGuid guid;
+    float data;
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        guid.read(cdr);
+        data = cdr.read<float>();
+        cdr.end_struct(end);
+    }
+
+    size_t key(uint8_t* out) const {
+        std::memcpy(out, guid.value, 16);
+        return 16;
+    }
+};
+
+// HEARTBEAT_COUNT e ACKNACK_COUNT: contatori cumulativi del writer o del reader
+struct StatsEntityCount {
+    static constexpr const char* TYPE_NAME = "eprosima::fastdds::statistics::EntityCount";
+    static constexpr uint32_t KEY_MAX_SIZE = 16;
+    StatsGuid guid;
+    uint64_t count;
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        guid.read(cdr);
+        count = cdr.read<uint64_t>();
+        cdr.end_struct(end);
+    }
+
+    size_t key(uint8_t* out) const {
+        std::memcpy(out, guid.value, 16);
+        return 16;
+    }
+};
+
+// PHYSICAL_DATA: macchina, utente e processo di un participant
+struct StatsPhysicalData {
+    static constexpr const char* TYPE_NAME = "eprosima::fastdds::statistics::PhysicalData";
+    static constexpr uint32_t KEY_MAX_SIZE = 16;
+    StatsGuid participant_guid;
+    char host[64];
+    char user[32];
+    char process[64];
+
+    void read(StatsCdrReader& cdr) {
+        uint32_t end = cdr.begin_struct();
+        participant_guid.read(cdr);
+        cdr.read_string(host, sizeof(host));
+        cdr.read_string(user, sizeof(user));
+        cdr.read_string(process, sizeof(process));
+        cdr.end_struct(end);
+    }
+
+    size_t key(uint8_t* out) const {
+        std::memcpy(out, participant_guid.value, 16);
+        return 16;
+    }
+};
+
+// TopicDataType solo in lettura per uno dei tipi sopra. Niente TypeObject: il match con i DataWriter di
+// statistiche si fa sul nome del tipo
+template <typename T>
+class StatisticsPubSubType : public eprosima::fastdds::dds::TopicDataType {
+public:
+    StatisticsPubSubType() {
+        set_name(T::TYPE_NAME);
+        // abbondante: con XCDR2 appendable ogni struttura annidata ha il suo DHEADER
+        max_serialized_type_size = 4 /*encapsulation*/ + static_cast<uint32_t>(sizeof(T)) * 2;
+        is_compute_key_provided = true;
+    }
+
+    bool serialize(const void* const data, eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                   eprosima::fastdds::dds::DataRepresentationId_t data_representation) override {
+        (void) data;
+        (void) payload;
+        (void) data_representation;
+        return false; // questi topic li scrive solo Fast DDS
+    }
+
+    bool deserialize(eprosima::fastdds::rtps::SerializedPayload_t& payload, void* data) override {
+        StatsCdrReader cdr;
+        if (!cdr.open(payload)) return false;
+        static_cast<T*>(data)->read(cdr);
+        return cdr.ok();
+    }
+
+    uint32_t calculate_serialized_size(const void* const data,
+                                       eprosima::fastdds::dds::DataRepresentationId_t data_representation) override {
+        (void) data;
+        (void) data_representation;
+        return max_serialized_type_size;
+    }
+
+    bool compute_key(eprosima::fastdds::rtps::SerializedPayload_t& payload,
+                     eprosima::fastdds::rtps::InstanceHandle_t& handle, bool force_md5 = false) override {
+        T sample;
+        if (!deserialize(payload, &sample)) return false;
+        return compute_key(&sample, handle, force_md5);
+    }
+
+    // key hash come da XTypes: la chiave big endian se sta in 16 byte, altrimenti il suo MD5
+    bool compute_key(const void* const data, eprosima::fastdds::rtps::InstanceHandle_t& handle,
+                     bool force_md5 = false) override {
+        uint8_t key[64] = {};
+        size_t size = static_cast<const T*>(data)->key(key);
+        if (force_md5 || T::KEY_MAX_SIZE > 16) {
+            eprosima::fastdds::MD5 md5;
+            md5.init();
+            md5.update(key, static_cast<unsigned int>(size));
+            md5.finalize();
+            for (size_t i = 0; i < 16; i++) handle.value[i] = md5.digest[i];
+        } else {
+            for (size_t i = 0; i < 16; i++) handle.value[i] = key[i];
+        }
+        return true;
+    }
+
+    void* create_data() override { return new T(); }
+
+    void delete_data(void* data) override { delete static_cast<T*>(data); }
+
+    void register_type_object_representation() override {}
+};
+
+#endif
@@ -0,0 +1,375 @@
+//raccoglitore delle statistiche Fast DDS: si abbona ai topic di statistiche che FlightSim, FlightComputer e MonitorApp
+//pubblicano con FBW_STATISTICS=basic|full e tiene, per ogni coppia writer/reader (GUID) o coppia di locator, un
+//istogramma a bucket logaritmici della latenza, più throughput e contatori HEARTBEAT/ACKNACK per entità.
+//Ogni intervallo stampa i percentili dell'ultima finestra e di tutto il run, da mettere accanto al jitter
+//applicativo di MonitorApp. Memoria fissa: le tabelle (FlatHashMap) si riservano all'avvio per il numero massimo
+//di voci, le entità oltre il limite si contano e si ignorano
+#include "FlatHashMap.hpp"
+#include "LatencyHistogram.hpp"
+#include "StatisticsTypes.hpp"
+#include "TransportProfile.hpp"
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/statistics/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/statistics/topic_names.hpp>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+using namespace eprosima::fastdds::dds;
+
+constexpr size_t MAX_LATENCY_PAIRS = 64;  // coppie writer -> reader di HISTORY_LATENCY
+constexpr size_t MAX_LOCATOR_PAIRS = 32;  // coppie di locator di NETWORK_LATENCY
+constexpr size_t MAX_ENTITIES = 128;      // writer e reader con throughput o contatori
+constexpr size_t MAX_PARTICIPANTS = 32;   // nomi dei processi da PHYSICAL_DATA
+constexpr int READER_DEPTH = 16;          // campioni per istanza nella storia di ogni reader
+
+// Tabella con chiave di KEY byte (GUID, coppie di GUID o di locator) e al massimo LIMIT voci, niente cancellazioni.
+// La FlatHashMap si riserva per LIMIT voci alla costruzione, quindi a regime non rialloca
+template <size_t KEY, typename Value, size_t LIMIT>
+class BoundedTable {
+    FlatHashMap<Value, std::array<uint8_t, KEY>> table{ LIMIT };
+
+    static std::array<uint8_t, KEY> key_of(const uint8_t* key) {
+        std::array<uint8_t, KEY> k;
+        std::memcpy(k.data(), key, KEY);
+        return k;
+    }
+
+public:
+    long overflow = 0; // campioni scartati perché la tabella era piena
+
+    // nullptr se la chiave non c'è
+    Value* find(const uint8_t* key) { return table.find(key_of(key)); }
+
+    // nullptr se la chiave è nuova e non c'è più posto; inserted dice se il posto è stato appena preso
+    Value* find_or_insert(const uint8_t* key, bool& inserted) {
+        std::array<uint8_t, KEY> k = key_of(key);
+        Value* v = table.find(k);
+        inserted = false;
+        if (v != nullptr) return v;
+        if (table.size() >= LIMIT) {
+            overflow++;
+            return nullptr;
+        }
+        inserted = true;
+        return &table[k];
+    }
+
+    template <typename F>
+    void for_each(F f) {
+        table.for_each([&](const std::array<uint8_t, KEY>&, Value& v) { f(v); });
+    }
+
+    size_t size() const { return table.size(); }
+};
+
+struct HistoryLatency {
+    StatsGuid writer;
+    StatsGuid reader;
+    LatencyHistogram window; // dall'ultima stampa
+    LatencyHistogram run;    // da quando il collector è partito
+};
+
+struct NetworkLatency {
+    StatsLocator src;
+    StatsLocator dst;
+    LatencyHistogram window;
+    LatencyHistogram run;
+};
+
+struct EntityStats {
+    StatsGuid guid;
+    bool publication;      // throughput di un writer (true) o di un reader
+    float throughput;      // ultimo valore, byte/s
+    float max_throughput;
+    uint64_t heartbeats;   // contatori cumulativi di Fast DDS
+    uint64_t acknacks;
+    uint64_t heartbeats_printed; // valori all'ultima stampa, per le differenze nella finestra
+    uint64_t acknacks_printed;
+};
+
+struct ParticipantName {
+    char process[64];
+    char host[64];
+};
+
+enum class StatsTopicKind { HISTORY_LATENCY, NETWORK_LATENCY, PUBLICATION_THROUGHPUT, SUBSCRIPTION_THROUGHPUT,
+                            HEARTBEAT_COUNT, ACKNACK_COUNT, PHYSICAL_DATA };
+
+class StatsCollector {
+    std::mutex mtx; // i listener arrivano da thread diversi di Fast DDS, la stampa dal main
+    BoundedTable<32, HistoryLatency, MAX_LATENCY_PAIRS> history;
+    BoundedTable<48, NetworkLatency, MAX_LOCATOR_PAIRS> network;
+    BoundedTable<16, EntityStats, MAX_ENTITIES> entities;
+    BoundedTable<12, ParticipantName, MAX_PARTICIPANTS> participants;
+    long samples_received = 0;
+
+    EntityStats* entity(const StatsGuid& guid) {
+        bool inserted;
+        EntityStats* e = entities.find_or_insert(guid.value, inserted);
+        if (e != nullptr && inserted) e->guid = guid;
+        return e;
+    }
+
+    // "processo/entityId" se PHYSICAL_DATA ha già dato il nome del participant, altrimenti prefisso/entityId
+    void guid_label(const StatsGuid& guid, char* out, size_t size) {
+        const ParticipantName* name = participants.find(guid.value);
+        const uint8_t* v = guid.value;
+        if (name != nullptr && name->process[0] != '\0') {
+            std::snprintf(out, size, "%.24s/%02x%02x%02x%02x", name->process, v[12], v[13], v[14], v[15]);
+        } else {
+            std::snprintf(out, size, "%02x%02x%02x%02x/%02x%02x%02x%02x", v[8], v[9], v[10], v[11],
+                          v[12], v[13], v[14], v[15]);
+        }
+    }
+
+    static void locator_label(const StatsLocator& locator, char* out, size_t size) {
+        const uint8_t* a = locator.address;
+        if (locator.kind == 1) std::snprintf(out, size, "udp %u.%u.%u.%u:%u", a[12], a[13], a[14], a[15], locator.port);
+        else if (locator.kind == 16) std::snprintf(out, size, "shm:%u", locator.port);
+        else std::snprintf(out, size, "kind %d:%u", (int) locator.kind, locator.port);
+    }
+
+    static void print_histogram_row(const char* label, const LatencyHistogram& h) {
+        std::printf("  %-44s %8llu %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", label, (unsigned long long) h.total,
+                    h.mean_ns() / 1000.0, h.percentile(50) / 1000.0, h.percentile(90) / 1000.0,
+                    h.percentile(99) / 1000.0, h.percentile(99.9) / 1000.0, h.max_ns / 1000.0);
+    }
+
+public:
+    void add(const StatsWriterReaderData& sample) {
+        uint8_t key[32];
+        sample.key(key);
+        std::lock_guard<std::mutex> lock(mtx);
+        samples_received++;
+        bool inserted;
+        HistoryLatency* h = history.find_or_insert(key, inserted);
+        if (h == nullptr) return;
+        if (inserted) {
+            h->writer = sample.writer_guid;
+            h->reader = sample.reader_guid;
+        }
+        uint64_t ns = sample.data > 0.0f ? (uint64_t) sample.data : 0;
+        h->window.record(ns);
+        h->run.record(ns);
+    }
+
+    void add(const StatsLocator2LocatorData& sample) {
+        uint8_t key[48];
+        sample.key(key);
+        std::lock_guard<std::mutex> lock(mtx);
+        samples_received++;
+        bool inserted;
+        NetworkLatency* n = network.find_or_insert(key, inserted);
+        if (n == nullptr) return;
+        if (inserted) {
+            n->src = sample.src_locator;
+            n->dst = sample.dst_locator;
+        }
+        uint64_t ns = sample.data > 0.0f ? (uint64_t) sample.data : 0;
+        n->window.record(ns);
+        n->run.record(ns);
+    }
+
+    void add(const StatsEntityData& sample, bool publication) {
+        std::lock_guard<std::mutex> lock(mtx);
+        samples_received++;
+        EntityStats* e = entity(sample.guid);
+        if (e == nullptr) return;
+        e->publication = publication;
+        e->throughput = sample.data;
+        if (sample.data > e->max_throughput) e->max_throughput = sample.data;
+    }
+
+    void add(const StatsEntityCount& sample, bool heartbeat) {
+        std::lock_guard<std::mutex> lock(mtx);
+        samples_received++;
+        EntityStats* e = entity(sample.guid);
+        if (e == nullptr) return;
+        if (heartbeat) e->heartbeats = sample.count;
+        else e->acknacks = sample.count;
+    }
+
+    void add(const StatsPhysicalData& sample) {
+        std::lock_guard<std::mutex> lock(mtx);
+        samples_received++;
+        bool inserted;
+        ParticipantName* p = participants.find_or_insert(sample.participant_guid.value, inserted);
+        if (p == nullptr) return;
+        std::memcpy(p->process, sample.process, sizeof(p->process));
+        std::memcpy(p->host, sample.host, sizeof(p->host));
+    }
+
+    // Riepilogo: percentili della finestra appena chiusa e di tutto il run, poi le finestre ripartono da zero
+    void print(long elapsed_s) {
+        std::lock_guard<std::mutex> lock(mtx);
+        char label[96], a[48], b[48];
+        std::printf("\n=== STATISTICHE FAST DDS dopo %ld s (%ld campioni di statistica) ===\n", elapsed_s, samples_received);
+        const char* header = "  %-44s %8s %9s %9s %9s %9s %9s %9s\n";
+
+        std::printf("HISTORY_LATENCY writer -> reader (us)\n");
+        std::printf(header, "", "campioni", "media", "p50", "p90", "p99", "p99.9", "max");
+        history.for_each([&](HistoryLatency& h) {
+            guid_label(h.writer, a, sizeof(a));
+            guid_label(h.reader, b, sizeof(b));
+            std::snprintf(label, sizeof(label), "%s -> %s", a, b);
+            print_histogram_row(label, h.window);
+            print_histogram_row("  (run)", h.run);
+            h.window.reset();
+        });
+
+        std::printf("NETWORK_LATENCY locator -> locator (us)\n");
+        std::printf(header, "", "campioni", "media", "p50", "p90", "p99", "p99.9", "max");
+        network.for_each([&](NetworkLatency& n) {
+            locator_label(n.src, a, sizeof(a));
+            locator_label(n.dst, b, sizeof(b));
+            std::snprintf(label, sizeof(label), "%s -> %s", a, b);
+            print_histogram_row(label, n.window);
+            print_histogram_row("  (run)", n.run);
+            n.window.reset();
+        });
+
+        std::printf("THROUGHPUT e controllo RELIABLE per writer (W) e reader (R)\n");
+        std::printf("  %-44s %12s %12s %12s %12s\n", "", "kB/s", "max kB/s", "+HEARTBEAT", "+ACKNACK");
+        entities.for_each([&](EntityStats& e) {
+            guid_label(e.guid, a, sizeof(a));
+            std::snprintf(label, sizeof(label), "%c %s", e.publication ? 'W' : 'R', a);
+            std::printf("  %-44s %12.1f %12.1f %12llu %12llu\n", label, e.throughput / 1000.0, e.max_throughput / 1000.0,
+                        (unsigned long long) (e.heartbeats - e.heartbeats_printed),
+                        (unsigned long long) (e.acknacks - e.acknacks_printed));
+            e.heartbeats_printed = e.heartbeats;
+            e.acknacks_printed = e.acknacks;
+        });
+
+        if (history.overflow + network.overflow + entities.overflow + participants.overflow > 0) {
+            std::printf("(tabelle piene, campioni ignorati: latenza %ld, rete %ld, entita' %ld, participant %ld)\n",
+                        history.overflow, network.overflow, entities.overflow, participants.overflow);
+        }
+        std::fflush(stdout);
+    }
+};
+
+// Un listener per topic: take di tutti i campioni arrivati e aggiornamento delle tabelle, senza allocare
+template <typename T>
+class StatsListener : public DataReaderListener {
+    StatsCollector& collector;
+    StatsTopicKind kind;
+
+public:
+    StatsListener(StatsCollector& collector, StatsTopicKind kind) : collector(collector), kind(kind) {}
+
+    void on_data_available(DataReader* reader) override {
+        T sample;
+        SampleInfo info;
+        while (reader->take_next_sample(&sample, &info) == RETCODE_OK) {
+            if (info.valid_data) dispatch(sample);
+        }
+    }
+
+private:
+    void dispatch(const StatsWriterReaderData& s) { collector.add(s); }
+    void dispatch(const StatsLocator2LocatorData& s) { collector.add(s); }
+    void dispatch(const StatsEntityData& s) { collector.add(s, kind == StatsTopicKind::PUBLICATION_THROUGHPUT); }
+    void dispatch(const StatsEntityCount& s) { collector.add(s, kind == StatsTopicKind::HEARTBEAT_COUNT); }
+    void dispatch(const StatsPhysicalData& s) { collector.add(s); }
+};
+
+StatsCollector collector; // globale: le tabelle (qualche centinaio di kB) si riservano prima di creare i reader
+
+StatsListener<StatsWriterReaderData> history_listener(collector, StatsTopicKind::HISTORY_LATENCY);
+StatsListener<StatsLocator2LocatorData> network_listener(collector, StatsTopicKind::NETWORK_LATENCY);
+StatsListener<StatsEntityData> publication_listener(collector, StatsTopicKind::PUBLICATION_THROUGHPUT);
+StatsListener<StatsEntityData> subscription_listener(collector, StatsTopicKind::SUBSCRIPTION_THROUGHPUT);
+StatsListener<StatsEntityCount> heartbeat_listener(collector, StatsTopicKind::HEARTBEAT_COUNT);
+StatsListener<StatsEntityCount> acknack_listener(collector, StatsTopicKind::ACKNACK_COUNT);
+StatsListener<StatsPhysicalData> physical_listener(collector, StatsTopicKind::PHYSICAL_DATA);
+
+// Topic di statistiche con il suo tipo e il reader con il listener
+template <typename T>
+DataReader* subscribe(DomainParticipant* participant, Subscriber* subscriber, const char* topic_name,
+                      const DataReaderQos& qos, StatsListener<T>& listener) {
+    TypeSupport type(new StatisticsPubSubType<T>());
+    type.register_type(participant); // per il secondo topic dello stesso tipo il nome è già registrato e va bene così
+    Topic* topic = participant->create_topic(topic_name, T::TYPE_NAME, TOPIC_QOS_DEFAULT);
+    if (topic == nullptr) return nullptr;
+    return subscriber->create_datareader(topic, qos, &listener);
+}
+
+int main(int argc, char* argv[]) {
+
+    // USO: ./StatsCollector [intervallo_s] [durata_s] [dominio]   (durata 0 = finché non si chiude)
+    //      FlightSim, FlightComputer e MonitorApp devono pubblicare le statistiche: FBW_STATISTICS=basic (throughput
+    //      e contatori) o full (anche le latenze e i nomi dei processi). Trasporto con FBW_TRANSPORT come gli altri
+    int interval_s = (argc > 1) ? std::stoi(argv[1]) : 5;
+    int duration_s = (argc > 2) ? std::stoi(argv[2]) : 0;
+    int domain = (argc > 3) ? std::stoi(argv[3]) : 0;
+    if (interval_s < 1) interval_s = 1;
+
+    TransportProfile transport = transport_profile_from_env();
+    DomainParticipantQos pqos;
+    pqos.name("StatsCollector");
+    setup_transport(pqos, transport);
+    // niente set_statistics_level: il collector non deve misurare sé stesso
+    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(domain, pqos);
+    if (participant == nullptr) return 1;
+    Subscriber* sub = participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+    // QoS dei DataWriter di statistiche (RELIABLE, TRANSIENT_LOCAL) con storia e istanze limitate come le tabelle,
+    // così anche i reader non crescono a regime
+    DataReaderQos rqos = eprosima::fastdds::statistics::dds::STATISTICS_DATAREADER_QOS;
+    rqos.history().kind = KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = READER_DEPTH;
+    rqos.resource_limits().max_instances = (int32_t) MAX_ENTITIES;
+    rqos.resource_limits().max_samples_per_instance = READER_DEPTH;
+    rqos.resource_limits().max_samples = (int32_t) MAX_ENTITIES * READER_DEPTH;
+    rqos.resource_limits().allocated_samples = (int32_t) MAX_ENTITIES * READER_DEPTH;
+
+    using namespace eprosima::fastdds::statistics;
+    DataReader* readers[] = {
+        subscribe(participant, sub, HISTORY_LATENCY_TOPIC, rqos, history_listener),
+        subscribe(participant, sub, NETWORK_LATENCY_TOPIC, rqos, network_listener),
+        subscribe(participant, sub, PUBLICATION_THROUGHPUT_TOPIC, rqos, publication_listener),
+        subscribe(participant, sub, SUBSCRIPTION_THROUGHPUT_TOPIC, rqos, subscription_listener),
+        subscribe(participant, sub, HEARTBEAT_COUNT_TOPIC, rqos, heartbeat_listener),
+        subscribe(participant, sub, ACKNACK_COUNT_TOPIC, rqos, acknack_listener),
+        subscribe(participant, sub, PHYSICAL_DATA_TOPIC, rqos, physical_listener),
+    };
+    for (DataReader* reader : readers) {
+        if (reader == nullptr) {
+            std::cerr << "Errore DDS Reader delle statistiche\n";
+            participant->delete_contained_entities();
+            DomainParticipantFactory::get_instance()->delete_participant(participant);
+            return 1;
+        }
+    }
+
+    std::cout << "=== STATS COLLECTOR IN ASCOLTO (dominio " << domain << ", trasporto " << transport_profile_name(transport)
+              << ", riepilogo ogni " << interval_s << " s) ===" << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    auto next = start;
+    while (true) {
+        next += std::chrono::seconds(interval_s);
+        std::this_thread::sleep_until(next);
+        long elapsed = (long) std::chrono::duration_cast<std::chrono::seconds>(next - start).count();
+        collector.print(elapsed);
+        if (duration_s > 0 && elapsed >= duration_s) break;
+    }
+
+    participant->delete_contained_entities();
+    DomainParticipantFactory::get_instance()->delete_participant(participant);
+    return 0;
+}
@@ -22,9 +22,11 @@
 #ifndef FAST_DDS_GENERATED__TELEMETRY_HPP
 #define FAST_DDS_GENERATED__TELEMETRY_HPP
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 #include <fastcdr/cdr/fixed_size_string.hpp>
 
 #if defined(_WIN32)
@@ -481,6 +483,1509 @@ private:
 
 };
 
+/*!
+ * @brief This class represents the structure SystemStatsPlain defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+class SystemStatsPlain
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport SystemStatsPlain()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~SystemStatsPlain()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object SystemStatsPlain that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsPlain(
+            const SystemStatsPlain& x)
+    {
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_speed = x.m_speed;
+
+                    m_deadline_missed = x.m_deadline_missed;
+
+                    m_status_msg = x.m_status_msg;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object SystemStatsPlain that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsPlain(
+            SystemStatsPlain&& x) noexcept
+    {
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_latency_us = x.m_latency_us;
+        m_speed = x.m_speed;
+        m_deadline_missed = x.m_deadline_missed;
+        m_status_msg = std::move(x.m_status_msg);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object SystemStatsPlain that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsPlain& operator =(
+            const SystemStatsPlain& x)
+    {
+
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_speed = x.m_speed;
+
+                    m_deadline_missed = x.m_deadline_missed;
+
+                    m_status_msg = x.m_status_msg;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object SystemStatsPlain that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsPlain& operator =(
+            SystemStatsPlain&& x) noexcept
+    {
+
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_latency_us = x.m_latency_us;
+        m_speed = x.m_speed;
+        m_deadline_missed = x.m_deadline_missed;
+        m_status_msg = std::move(x.m_status_msg);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsPlain object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const SystemStatsPlain& x) const
+    {
+        return (m_packet_id == x.m_packet_id &&
+           m_roll == x.m_roll &&
+           m_pitch == x.m_pitch &&
+           m_yaw == x.m_yaw &&
+           m_altitude == x.m_altitude &&
+           m_latency_us == x.m_latency_us &&
+           m_speed == x.m_speed &&
+           m_deadline_missed == x.m_deadline_missed &&
+           m_status_msg == x.m_status_msg);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsPlain object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const SystemStatsPlain& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member packet_id
+     * @param _packet_id New value for member packet_id
+     */
+    eProsima_user_DllExport void packet_id(
+            uint32_t _packet_id)
+    {
+        m_packet_id = _packet_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member packet_id
+     * @return Value of member packet_id
+     */
+    eProsima_user_DllExport uint32_t packet_id() const
+    {
+        return m_packet_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member packet_id
+     * @return Reference to member packet_id
+     */
+    eProsima_user_DllExport uint32_t& packet_id()
+    {
+        return m_packet_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member roll
+     * @param _roll New value for member roll
+     */
+    eProsima_user_DllExport void roll(
+            float _roll)
+    {
+        m_roll = _roll;
+    }
+
+    /*!
+     * @brief This function returns the value of member roll
+     * @return Value of member roll
+     */
+    eProsima_user_DllExport float roll() const
+    {
+        return m_roll;
+    }
+
+    /*!
+     * @brief This function returns a reference to member roll
+     * @return Reference to member roll
+     */
+    eProsima_user_DllExport float& roll()
+    {
+        return m_roll;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member pitch
+     * @param _pitch New value for member pitch
+     */
+    eProsima_user_DllExport void pitch(
+            float _pitch)
+    {
+        m_pitch = _pitch;
+    }
+
+    /*!
+     * @brief This function returns the value of member pitch
+     * @return Value of member pitch
+     */
+    eProsima_user_DllExport float pitch() const
+    {
+        return m_pitch;
+    }
+
+    /*!
+     * @brief This function returns a reference to member pitch
+     * @return Reference to member pitch
+     */
+    eProsima_user_DllExport float& pitch()
+    {
+        return m_pitch;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member yaw
+     * @param _yaw New value for member yaw
+     */
+    eProsima_user_DllExport void yaw(
+            float _yaw)
+    {
+        m_yaw = _yaw;
+    }
+
+    /*!
+     * @brief This function returns the value of member yaw
+     * @return Value of member yaw
+     */
+    eProsima_user_DllExport float yaw() const
+    {
+        return m_yaw;
+    }
+
+    /*!
+     * @brief This function returns a reference to member yaw
+     * @return Reference to member yaw
+     */
+    eProsima_user_DllExport float& yaw()
+    {
+        return m_yaw;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member altitude
+     * @param _altitude New value for member altitude
+     */
+    eProsima_user_DllExport void altitude(
+            float _altitude)
+    {
+        m_altitude = _altitude;
+    }
+
+    /*!
+     * @brief This function returns the value of member altitude
+     * @return Value of member altitude
+     */
+    eProsima_user_DllExport float altitude() const
+    {
+        return m_altitude;
+    }
+
+    /*!
+     * @brief This function returns a reference to member altitude
+     * @return Reference to member altitude
+     */
+    eProsima_user_DllExport float& altitude()
+    {
+        return m_altitude;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member latency_us
+     * @param _latency_us New value for member latency_us
+     */
+    eProsima_user_DllExport void latency_us(
+            float _latency_us)
+    {
+        m_latency_us = _latency_us;
+    }
+
+    /*!
+     * @brief This function returns the value of member latency_us
+     * @return Value of member latency_us
+     */
+    eProsima_user_DllExport float latency_us() const
+    {
+        return m_latency_us;
+    }
+
+    /*!
+     * @brief This function returns a reference to member latency_us
+     * @return Reference to member latency_us
+     */
+    eProsima_user_DllExport float& latency_us()
+    {
+        return m_latency_us;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member speed
+     * @param _speed New value for member speed
+     */
+    eProsima_user_DllExport void speed(
+            float _speed)
+    {
+        m_speed = _speed;
+    }
+
+    /*!
+     * @brief This function returns the value of member speed
+     * @return Value of member speed
+     */
+    eProsima_user_DllExport float speed() const
+    {
+        return m_speed;
+    }
+
+    /*!
+     * @brief This function returns a reference to member speed
+     * @return Reference to member speed
+     */
+    eProsima_user_DllExport float& speed()
+    {
+        return m_speed;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member deadline_missed
+     * @param _deadline_missed New value for member deadline_missed
+     */
+    eProsima_user_DllExport void deadline_missed(
+            bool _deadline_missed)
+    {
+        m_deadline_missed = _deadline_missed;
+    }
+
+    /*!
+     * @brief This function returns the value of member deadline_missed
+     * @return Value of member deadline_missed
+     */
+    eProsima_user_DllExport bool deadline_missed() const
+    {
+        return m_deadline_missed;
+    }
+
+    /*!
+     * @brief This function returns a reference to member deadline_missed
+     * @return Reference to member deadline_missed
+     */
+    eProsima_user_DllExport bool& deadline_missed()
+    {
+        return m_deadline_missed;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member status_msg
+     * @param _status_msg New value to be copied in member status_msg
+     */
+    eProsima_user_DllExport void status_msg(
+            const std::array<char, 32>& _status_msg)
+    {
+        m_status_msg = _status_msg;
+    }
+
+    /*!
+     * @brief This function moves the value in member status_msg
+     * @param _status_msg New value to be moved in member status_msg
+     */
+    eProsima_user_DllExport void status_msg(
+            std::array<char, 32>&& _status_msg)
+    {
+        m_status_msg = std::move(_status_msg);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member status_msg
+     * @return Constant reference to member status_msg
+     */
+    eProsima_user_DllExport const std::array<char, 32>& status_msg() const
+    {
+        return m_status_msg;
+    }
+
+    /*!
+     * @brief This function returns a reference to member status_msg
+     * @return Reference to member status_msg
+     */
+    eProsima_user_DllExport std::array<char, 32>& status_msg()
+    {
+        return m_status_msg;
+    }
+
+
+
+private:
+
+    uint32_t m_packet_id{0};
+    float m_roll{0.0};
+    float m_pitch{0.0};
+    float m_yaw{0.0};
+    float m_altitude{0.0};
+    float m_latency_us{0.0};
+    float m_speed{0.0};
+    bool m_deadline_missed{false};
+    std::array<char, 32> m_status_msg{0};
+
+};
+
+/*!
+ * @brief This class represents the enumeration FlightStatus defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+enum class FlightStatus : int32_t
+{
+    NOMINAL_FLIGHT,
+    AUTOPILOT_RECOVERY,
+    WARN_HIGH_BANK,
+    ALARM_TERRAIN_PULL_UP,
+    ALARM_HIGH_ALTITUDE
+};
+
+/*!
+ * @brief This class represents the bitmask TelemetryFlags defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+enum TelemetryFlagsBits : uint8_t
+{
+    FLAG_DEADLINE_MISSED = 0x01ull << 0,
+    FLAG_AUTOPILOT = 0x01ull << 1,
+    FLAG_RECOVERY_BANK = 0x01ull << 2
+};
+typedef uint8_t TelemetryFlags;
+
+/*!
+ * @brief This class represents the structure SystemStatsV2 defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+class SystemStatsV2
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport SystemStatsV2()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~SystemStatsV2()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object SystemStatsV2 that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsV2(
+            const SystemStatsV2& x)
+    {
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_speed = x.m_speed;
+
+                    m_status = x.m_status;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_flags = x.m_flags;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object SystemStatsV2 that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsV2(
+            SystemStatsV2&& x) noexcept
+    {
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_speed = x.m_speed;
+        m_status = x.m_status;
+        m_latency_us = x.m_latency_us;
+        m_flags = x.m_flags;
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object SystemStatsV2 that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsV2& operator =(
+            const SystemStatsV2& x)
+    {
+
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_speed = x.m_speed;
+
+                    m_status = x.m_status;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_flags = x.m_flags;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object SystemStatsV2 that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsV2& operator =(
+            SystemStatsV2&& x) noexcept
+    {
+
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_speed = x.m_speed;
+        m_status = x.m_status;
+        m_latency_us = x.m_latency_us;
+        m_flags = x.m_flags;
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsV2 object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const SystemStatsV2& x) const
+    {
+        return (m_packet_id == x.m_packet_id &&
+           m_roll == x.m_roll &&
+           m_pitch == x.m_pitch &&
+           m_yaw == x.m_yaw &&
+           m_altitude == x.m_altitude &&
+           m_speed == x.m_speed &&
+           m_status == x.m_status &&
+           m_latency_us == x.m_latency_us &&
+           m_flags == x.m_flags);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsV2 object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const SystemStatsV2& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member packet_id
+     * @param _packet_id New value for member packet_id
+     */
+    eProsima_user_DllExport void packet_id(
+            uint32_t _packet_id)
+    {
+        m_packet_id = _packet_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member packet_id
+     * @return Value of member packet_id
+     */
+    eProsima_user_DllExport uint32_t packet_id() const
+    {
+        return m_packet_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member packet_id
+     * @return Reference to member packet_id
+     */
+    eProsima_user_DllExport uint32_t& packet_id()
+    {
+        return m_packet_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member roll
+     * @param _roll New value for member roll
+     */
+    eProsima_user_DllExport void roll(
+            float _roll)
+    {
+        m_roll = _roll;
+    }
+
+    /*!
+     * @brief This function returns the value of member roll
+     * @return Value of member roll
+     */
+    eProsima_user_DllExport float roll() const
+    {
+        return m_roll;
+    }
+
+    /*!
+     * @brief This function returns a reference to member roll
+     * @return Reference to member roll
+     */
+    eProsima_user_DllExport float& roll()
+    {
+        return m_roll;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member pitch
+     * @param _pitch New value for member pitch
+     */
+    eProsima_user_DllExport void pitch(
+            float _pitch)
+    {
+        m_pitch = _pitch;
+    }
+
+    /*!
+     * @brief This function returns the value of member pitch
+     * @return Value of member pitch
+     */
+    eProsima_user_DllExport float pitch() const
+    {
+        return m_pitch;
+    }
+
+    /*!
+     * @brief This function returns a reference to member pitch
+     * @return Reference to member pitch
+     */
+    eProsima_user_DllExport float& pitch()
+    {
+        return m_pitch;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member yaw
+     * @param _yaw New value for member yaw
+     */
+    eProsima_user_DllExport void yaw(
+            float _yaw)
+    {
+        m_yaw = _yaw;
+    }
+
+    /*!
+     * @brief This function returns the value of member yaw
+     * @return Value of member yaw
+     */
+    eProsima_user_DllExport float yaw() const
+    {
+        return m_yaw;
+    }
+
+    /*!
+     * @brief This function returns a reference to member yaw
+     * @return Reference to member yaw
+     */
+    eProsima_user_DllExport float& yaw()
+    {
+        return m_yaw;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member altitude
+     * @param _altitude New value for member altitude
+     */
+    eProsima_user_DllExport void altitude(
+            float _altitude)
+    {
+        m_altitude = _altitude;
+    }
+
+    /*!
+     * @brief This function returns the value of member altitude
+     * @return Value of member altitude
+     */
+    eProsima_user_DllExport float altitude() const
+    {
+        return m_altitude;
+    }
+
+    /*!
+     * @brief This function returns a reference to member altitude
+     * @return Reference to member altitude
+     */
+    eProsima_user_DllExport float& altitude()
+    {
+        return m_altitude;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member speed
+     * @param _speed New value for member speed
+     */
+    eProsima_user_DllExport void speed(
+            float _speed)
+    {
+        m_speed = _speed;
+    }
+
+    /*!
+     * @brief This function returns the value of member speed
+     * @return Value of member speed
+     */
+    eProsima_user_DllExport float speed() const
+    {
+        return m_speed;
+    }
+
+    /*!
+     * @brief This function returns a reference to member speed
+     * @return Reference to member speed
+     */
+    eProsima_user_DllExport float& speed()
+    {
+        return m_speed;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member status
+     * @param _status New value for member status
+     */
+    eProsima_user_DllExport void status(
+            FlightStatus _status)
+    {
+        m_status = _status;
+    }
+
+    /*!
+     * @brief This function returns the value of member status
+     * @return Value of member status
+     */
+    eProsima_user_DllExport FlightStatus status() const
+    {
+        return m_status;
+    }
+
+    /*!
+     * @brief This function returns a reference to member status
+     * @return Reference to member status
+     */
+    eProsima_user_DllExport FlightStatus& status()
+    {
+        return m_status;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member latency_us
+     * @param _latency_us New value for member latency_us
+     */
+    eProsima_user_DllExport void latency_us(
+            uint16_t _latency_us)
+    {
+        m_latency_us = _latency_us;
+    }
+
+    /*!
+     * @brief This function returns the value of member latency_us
+     * @return Value of member latency_us
+     */
+    eProsima_user_DllExport uint16_t latency_us() const
+    {
+        return m_latency_us;
+    }
+
+    /*!
+     * @brief This function returns a reference to member latency_us
+     * @return Reference to member latency_us
+     */
+    eProsima_user_DllExport uint16_t& latency_us()
+    {
+        return m_latency_us;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member flags
+     * @param _flags New value for member flags
+     */
+    eProsima_user_DllExport void flags(
+            TelemetryFlags _flags)
+    {
+        m_flags = _flags;
+    }
+
+    /*!
+     * @brief This function returns the value of member flags
+     * @return Value of member flags
+     */
+    eProsima_user_DllExport TelemetryFlags flags() const
+    {
+        return m_flags;
+    }
+
+    /*!
+     * @brief This function returns a reference to member flags
+     * @return Reference to member flags
+     */
+    eProsima_user_DllExport TelemetryFlags& flags()
+    {
+        return m_flags;
+    }
+
+
+
+private:
+
+    uint32_t m_packet_id{0};
+    float m_roll{0.0};
+    float m_pitch{0.0};
+    float m_yaw{0.0};
+    float m_altitude{0.0};
+    float m_speed{0.0};
+    FlightStatus m_status{FlightStatus::NOMINAL_FLIGHT};
+    uint16_t m_latency_us{0};
+    TelemetryFlags m_flags{0};
+
+};
+
+/*!
+ * @brief This class represents the structure SystemStatsBatch defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+class SystemStatsBatch
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport SystemStatsBatch()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~SystemStatsBatch()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object SystemStatsBatch that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsBatch(
+            const SystemStatsBatch& x)
+    {
+                    m_batch_id = x.m_batch_id;
+
+                    m_samples = x.m_samples;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object SystemStatsBatch that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsBatch(
+            SystemStatsBatch&& x) noexcept
+    {
+        m_batch_id = x.m_batch_id;
+        m_samples = std::move(x.m_samples);
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object SystemStatsBatch that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsBatch& operator =(
+            const SystemStatsBatch& x)
+    {
+
+                    m_batch_id = x.m_batch_id;
+
+                    m_samples = x.m_samples;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object SystemStatsBatch that will be copied.
+     */
+    eProsima_user_DllExport SystemStatsBatch& operator =(
+            SystemStatsBatch&& x) noexcept
+    {
+
+        m_batch_id = x.m_batch_id;
+        m_samples = std::move(x.m_samples);
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const SystemStatsBatch& x) const
+    {
+        return (m_batch_id == x.m_batch_id &&
+           m_samples == x.m_samples);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x SystemStatsBatch object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const SystemStatsBatch& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member batch_id
+     * @param _batch_id New value for member batch_id
+     */
+    eProsima_user_DllExport void batch_id(
+            uint32_t _batch_id)
+    {
+        m_batch_id = _batch_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member batch_id
+     * @return Value of member batch_id
+     */
+    eProsima_user_DllExport uint32_t batch_id() const
+    {
+        return m_batch_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member batch_id
+     * @return Reference to member batch_id
+     */
+    eProsima_user_DllExport uint32_t& batch_id()
+    {
+        return m_batch_id;
+    }
+
+
+    /*!
+     * @brief This function copies the value in member samples
+     * @param _samples New value to be copied in member samples
+     */
+    eProsima_user_DllExport void samples(
+            const std::vector<SystemStatsV2>& _samples)
+    {
+        m_samples = _samples;
+    }
+
+    /*!
+     * @brief This function moves the value in member samples
+     * @param _samples New value to be moved in member samples
+     */
+    eProsima_user_DllExport void samples(
+            std::vector<SystemStatsV2>&& _samples)
+    {
+        m_samples = std::move(_samples);
+    }
+
+    /*!
+     * @brief This function returns a constant reference to member samples
+     * @return Constant reference to member samples
+     */
+    eProsima_user_DllExport const std::vector<SystemStatsV2>& samples() const
+    {
+        return m_samples;
+    }
+
+    /*!
+     * @brief This function returns a reference to member samples
+     * @return Reference to member samples
+     */
+    eProsima_user_DllExport std::vector<SystemStatsV2>& samples()
+    {
+        return m_samples;
+    }
+
+
+
+private:
+
+    uint32_t m_batch_id{0};
+    std::vector<SystemStatsV2> m_samples;
+
+};
+
+/*!
+ * @brief This class represents the structure AircraftTelemetry defined by the user in the IDL file.
+ * @ingroup Telemetry
+ */
+class AircraftTelemetry
+{
+public:
+
+    /*!
+     * @brief Default constructor.
+     */
+    eProsima_user_DllExport AircraftTelemetry()
+    {
+    }
+
+    /*!
+     * @brief Default destructor.
+     */
+    eProsima_user_DllExport ~AircraftTelemetry()
+    {
+    }
+
+    /*!
+     * @brief Copy constructor.
+     * @param x Reference to the object AircraftTelemetry that will be copied.
+     */
+    eProsima_user_DllExport AircraftTelemetry(
+            const AircraftTelemetry& x)
+    {
+                    m_aircraft_id = x.m_aircraft_id;
+
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_speed = x.m_speed;
+
+                    m_status = x.m_status;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_flags = x.m_flags;
+
+    }
+
+    /*!
+     * @brief Move constructor.
+     * @param x Reference to the object AircraftTelemetry that will be copied.
+     */
+    eProsima_user_DllExport AircraftTelemetry(
+            AircraftTelemetry&& x) noexcept
+    {
+        m_aircraft_id = x.m_aircraft_id;
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_speed = x.m_speed;
+        m_status = x.m_status;
+        m_latency_us = x.m_latency_us;
+        m_flags = x.m_flags;
+    }
+
+    /*!
+     * @brief Copy assignment.
+     * @param x Reference to the object AircraftTelemetry that will be copied.
+     */
+    eProsima_user_DllExport AircraftTelemetry& operator =(
+            const AircraftTelemetry& x)
+    {
+
+                    m_aircraft_id = x.m_aircraft_id;
+
+                    m_packet_id = x.m_packet_id;
+
+                    m_roll = x.m_roll;
+
+                    m_pitch = x.m_pitch;
+
+                    m_yaw = x.m_yaw;
+
+                    m_altitude = x.m_altitude;
+
+                    m_speed = x.m_speed;
+
+                    m_status = x.m_status;
+
+                    m_latency_us = x.m_latency_us;
+
+                    m_flags = x.m_flags;
+
+        return *this;
+    }
+
+    /*!
+     * @brief Move assignment.
+     * @param x Reference to the object AircraftTelemetry that will be copied.
+     */
+    eProsima_user_DllExport AircraftTelemetry& operator =(
+            AircraftTelemetry&& x) noexcept
+    {
+
+        m_aircraft_id = x.m_aircraft_id;
+        m_packet_id = x.m_packet_id;
+        m_roll = x.m_roll;
+        m_pitch = x.m_pitch;
+        m_yaw = x.m_yaw;
+        m_altitude = x.m_altitude;
+        m_speed = x.m_speed;
+        m_status = x.m_status;
+        m_latency_us = x.m_latency_us;
+        m_flags = x.m_flags;
+        return *this;
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x AircraftTelemetry object to compare.
+     */
+    eProsima_user_DllExport bool operator ==(
+            const AircraftTelemetry& x) const
+    {
+        return (m_aircraft_id == x.m_aircraft_id &&
+           m_packet_id == x.m_packet_id &&
+           m_roll == x.m_roll &&
+           m_pitch == x.m_pitch &&
+           m_yaw == x.m_yaw &&
+           m_altitude == x.m_altitude &&
+           m_speed == x.m_speed &&
+           m_status == x.m_status &&
+           m_latency_us == x.m_latency_us &&
+           m_flags == x.m_flags);
+    }
+
+    /*!
+     * @brief Comparison operator.
+     * @param x AircraftTelemetry object to compare.
+     */
+    eProsima_user_DllExport bool operator !=(
+            const AircraftTelemetry& x) const
+    {
+        return !(*this == x);
+    }
+
+    /*!
+     * @brief This function sets a value in member aircraft_id
+     * @param _aircraft_id New value for member aircraft_id
+     */
+    eProsima_user_DllExport void aircraft_id(
+            uint32_t _aircraft_id)
+    {
+        m_aircraft_id = _aircraft_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member aircraft_id
+     * @return Value of member aircraft_id
+     */
+    eProsima_user_DllExport uint32_t aircraft_id() const
+    {
+        return m_aircraft_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member aircraft_id
+     * @return Reference to member aircraft_id
+     */
+    eProsima_user_DllExport uint32_t& aircraft_id()
+    {
+        return m_aircraft_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member packet_id
+     * @param _packet_id New value for member packet_id
+     */
+    eProsima_user_DllExport void packet_id(
+            uint32_t _packet_id)
+    {
+        m_packet_id = _packet_id;
+    }
+
+    /*!
+     * @brief This function returns the value of member packet_id
+     * @return Value of member packet_id
+     */
+    eProsima_user_DllExport uint32_t packet_id() const
+    {
+        return m_packet_id;
+    }
+
+    /*!
+     * @brief This function returns a reference to member packet_id
+     * @return Reference to member packet_id
+     */
+    eProsima_user_DllExport uint32_t& packet_id()
+    {
+        return m_packet_id;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member roll
+     * @param _roll New value for member roll
+     */
+    eProsima_user_DllExport void roll(
+            float _roll)
+    {
+        m_roll = _roll;
+    }
+
+    /*!
+     * @brief This function returns the value of member roll
+     * @return Value of member roll
+     */
+    eProsima_user_DllExport float roll() const
+    {
+        return m_roll;
+    }
+
+    /*!
+     * @brief This function returns a reference to member roll
+     * @return Reference to member roll
+     */
+    eProsima_user_DllExport float& roll()
+    {
+        return m_roll;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member pitch
+     * @param _pitch New value for member pitch
+     */
+    eProsima_user_DllExport void pitch(
+            float _pitch)
+    {
+        m_pitch = _pitch;
+    }
+
+    /*!
+     * @brief This function returns the value of member pitch
+     * @return Value of member pitch
+     */
+    eProsima_user_DllExport float pitch() const
+    {
+        return m_pitch;
+    }
+
+    /*!
+     * @brief This function returns a reference to member pitch
+     * @return Reference to member pitch
+     */
+    eProsima_user_DllExport float& pitch()
+    {
+        return m_pitch;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member yaw
+     * @param _yaw New value for member yaw
+     */
+    eProsima_user_DllExport void yaw(
+            float _yaw)
+    {
+        m_yaw = _yaw;
+    }
+
+    /*!
+     * @brief This function returns the value of member yaw
+     * @return Value of member yaw
+     */
+    eProsima_user_DllExport float yaw() const
+    {
+        return m_yaw;
+    }
+
+    /*!
+     * @brief This function returns a reference to member yaw
+     * @return Reference to member yaw
+     */
+    eProsima_user_DllExport float& yaw()
+    {
+        return m_yaw;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member altitude
+     * @param _altitude New value for member altitude
+     */
+    eProsima_user_DllExport void altitude(
+            float _altitude)
+    {
+        m_altitude = _altitude;
+    }
+
+    /*!
+     * @brief This function returns the value of member altitude
+     * @return Value of member altitude
+     */
+    eProsima_user_DllExport float altitude() const
+    {
+        return m_altitude;
+    }
+
+    /*!
+     * @brief This function returns a reference to member altitude
+     * @return Reference to member altitude
+     */
+    eProsima_user_DllExport float& altitude()
+    {
+        return m_altitude;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member speed
+     * @param _speed New value for member speed
+     */
+    eProsima_user_DllExport void speed(
+            float _speed)
+    {
+        m_speed = _speed;
+    }
+
+    /*!
+     * @brief This function returns the value of member speed
+     * @return Value of member speed
+     */
+    eProsima_user_DllExport float speed() const
+    {
+        return m_speed;
+    }
+
+    /*!
+     * @brief This function returns a reference to member speed
+     * @return Reference to member speed
+     */
+    eProsima_user_DllExport float& speed()
+    {
+        return m_speed;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member status
+     * @param _status New value for member status
+     */
+    eProsima_user_DllExport void status(
+            FlightStatus _status)
+    {
+        m_status = _status;
+    }
+
+    /*!
+     * @brief This function returns the value of member status
+     * @return Value of member status
+     */
+    eProsima_user_DllExport FlightStatus status() const
+    {
+        return m_status;
+    }
+
+    /*!
+     * @brief This function returns a reference to member status
+     * @return Reference to member status
+     */
+    eProsima_user_DllExport FlightStatus& status()
+    {
+        return m_status;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member latency_us
+     * @param _latency_us New value for member latency_us
+     */
+    eProsima_user_DllExport void latency_us(
+            uint16_t _latency_us)
+    {
+        m_latency_us = _latency_us;
+    }
+
+    /*!
+     * @brief This function returns the value of member latency_us
+     * @return Value of member latency_us
+     */
+    eProsima_user_DllExport uint16_t latency_us() const
+    {
+        return m_latency_us;
+    }
+
+    /*!
+     * @brief This function returns a reference to member latency_us
+     * @return Reference to member latency_us
+     */
+    eProsima_user_DllExport uint16_t& latency_us()
+    {
+        return m_latency_us;
+    }
+
+
+    /*!
+     * @brief This function sets a value in member flags
+     * @param _flags New value for member flags
+     */
+    eProsima_user_DllExport void flags(
+            TelemetryFlags _flags)
+    {
+        m_flags = _flags;
+    }
+
+    /*!
+     * @brief This function returns the value of member flags
+     * @return Value of member flags
+     */
+    eProsima_user_DllExport TelemetryFlags flags() const
+    {
+        return m_flags;
+    }
+
+    /*!
+     * @brief This function returns a reference to member flags
+     * @return Reference to member flags
+     */
+    eProsima_user_DllExport TelemetryFlags& flags()
+    {
+        return m_flags;
+    }
+
+
+
+private:
+
+    uint32_t m_aircraft_id{0};
+    uint32_t m_packet_id{0};
+    float m_roll{0.0};
+    float m_pitch{0.0};
+    float m_yaw{0.0};
+    float m_altitude{0.0};
+    float m_speed{0.0};
+    FlightStatus m_status{FlightStatus::NOMINAL_FLIGHT};
+    uint16_t m_latency_us{0};
+    TelemetryFlags m_flags{0};
+
+};
+
 #endif // _FAST_DDS_GENERATED_TELEMETRY_HPP_
 
 
@@ -0,0 +1,66 @@
+//telemetria v2 a pacchetti: il computer di volo accumula i campioni in un SystemStatsBatch e lo spedisce quando
+//è pieno o quando il primo campione in attesa è più vecchio della finestra. Chi legge TelemetryBatchTopic
+//spacchetta e tratta ogni campione come se fosse arrivato da solo su TelemetryV2Topic
+#ifndef TELEMETRY_BATCH_HPP
+#define TELEMETRY_BATCH_HPP
+
+#include "TelemetryPubSubTypes.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+constexpr const char* TELEMETRY_BATCH_TOPIC = "TelemetryBatchTopic";
+
+// stesso limite della sequence<SystemStatsV2, 256> nell'IDL
+constexpr size_t TELEMETRY_BATCH_MAX = 256;
+
+// finestra di default: a 20 Hz (il periodo del monitor) un batch non aspetta più di un ciclo
+constexpr int TELEMETRY_BATCH_WINDOW_MS = 20;
+
+class TelemetryBatcher {
+    SystemStatsBatch batch;
+    size_t max_samples = 1;
+    std::chrono::steady_clock::duration window = std::chrono::milliseconds(TELEMETRY_BATCH_WINDOW_MS);
+    std::chrono::steady_clock::time_point first; // arrivo del primo campione in attesa
+
+public:
+    // la memoria del batch si prende qui una volta sola, poi clear() tiene la capacità
+    void configure(size_t samples, int window_ms) {
+        max_samples = std::min(std::max<size_t>(samples, 1), TELEMETRY_BATCH_MAX);
+        window = std::chrono::milliseconds(window_ms);
+        batch.samples().reserve(max_samples);
+    }
+
+    size_t capacity() const { return max_samples; }
+    bool empty() const { return batch.samples().empty(); }
+
+    // posto per il prossimo campione, lo riempie chi chiama
+    SystemStatsV2& next() {
+        if (batch.samples().empty()) first = std::chrono::steady_clock::now();
+        batch.samples().emplace_back();
+        return batch.samples().back();
+    }
+
+    // pieno, oppure il campione più vecchio ha già aspettato tutta la finestra
+    bool due() const {
+        if (batch.samples().empty()) return false;
+        return batch.samples().size() >= max_samples || std::chrono::steady_clock::now() - first >= window;
+    }
+
+    // quanto si può ancora dormire sul bus prima di dover spedire (-1 = niente in attesa, senza limite)
+    int timeout_ms() const {
+        if (batch.samples().empty()) return -1;
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(first + window - std::chrono::steady_clock::now());
+        return left.count() > 0 ? (int) left.count() : 0;
+    }
+
+    const SystemStatsBatch& pending() const { return batch; }
+
+    // dopo la write: il batch successivo riparte vuoto con il numero dopo
+    void sent() {
+        batch.batch_id(batch.batch_id() + 1);
+        batch.samples().clear();
+    }
+};
+
+#endif
@@ -26,6 +26,18 @@
 constexpr uint32_t SystemStats_max_cdr_typesize {73UL};
 constexpr uint32_t SystemStats_max_key_cdr_typesize {0UL};
 
+constexpr uint32_t SystemStatsPlain_max_cdr_typesize {61UL};
+constexpr uint32_t SystemStatsPlain_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t SystemStatsV2_max_cdr_typesize {31UL};
+constexpr uint32_t SystemStatsV2_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t SystemStatsBatch_max_cdr_typesize {8207UL};
+constexpr uint32_t SystemStatsBatch_max_key_cdr_typesize {0UL};
+
+constexpr uint32_t AircraftTelemetry_max_cdr_typesize {35UL};
+constexpr uint32_t AircraftTelemetry_max_key_cdr_typesize {4UL};
+
 
 namespace eprosima {
 namespace fastcdr {
@@ -37,6 +49,22 @@ eProsima_user_DllExport void serialize_key(
         eprosima::fastcdr::Cdr& scdr,
         const SystemStats& data);
 
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const SystemStatsPlain& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const SystemStatsV2& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const SystemStatsBatch& data);
+
+eProsima_user_DllExport void serialize_key(
+        eprosima::fastcdr::Cdr& scdr,
+        const AircraftTelemetry& data);
+
 
 } // namespace fastcdr
 } // namespace eprosima
@@ -0,0 +1,92 @@
+//decimazione per lettore: un monitor chiede al massimo N campioni al secondo con un ContentFilteredTopic.
+//La QoS TIME_BASED_FILTER in Fast DDS c'è ma non filtra niente, quindi il filtro è registrato a mano:
+//tiene l'istante dell'ultimo campione accettato e scarta quelli che arrivano prima della separazione minima.
+//Se il participant del writer ha lo stesso filtro registrato (create_telemetry_participant lo fa) il filtro gira
+//nel writer, uno per ogni lettore, e i campioni scartati non partono proprio: al lettore RELIABLE arriva solo
+//un GAP. Altrimenti filtra il lettore all'arrivo, la rete non risparmia niente ma la dashboard sì
+#ifndef TELEMETRY_DECIMATION_HPP
+#define TELEMETRY_DECIMATION_HPP
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/dds/topic/IContentFilterFactory.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// nome della classe di filtro, uguale in chi scrive e in chi legge
+constexpr const char* TELEMETRY_DECIMATION_FILTER = "FBW_MIN_SEPARATION";
+
+class MinSeparationFilter : public eprosima::fastdds::dds::IContentFilter {
+    std::atomic<long> min_separation_ns{0};
+    mutable std::atomic<long> last_ns{0}; // ultimo campione passato, sull'orologio di chi valuta
+
+public:
+    void set_min_separation_us(long us) { min_separation_ns.store(us * 1000, std::memory_order_relaxed); }
+
+    bool evaluate(const SerializedPayload& payload, const FilterSampleInfo& sample_info,
+                  const GUID_t& reader_guid) const override {
+        (void) payload;
+        (void) sample_info;
+        (void) reader_guid;
+        long now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (now - last_ns.load(std::memory_order_relaxed) < min_separation_ns.load(std::memory_order_relaxed)) return false;
+        last_ns.store(now, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+// L'unico parametro è la separazione minima in microsecondi, l'espressione serve solo a chi legge la discovery
+class MinSeparationFilterFactory : public eprosima::fastdds::dds::IContentFilterFactory {
+public:
+    eprosima::fastdds::dds::ReturnCode_t create_content_filter(const char* filter_class_name, const char* type_name,
+            const eprosima::fastdds::dds::TopicDataType* data_type, const char* filter_expression,
+            const ParameterSeq& filter_parameters, eprosima::fastdds::dds::IContentFilter*& filter_instance) override {
+        (void) filter_class_name;
+        (void) type_name;
+        (void) data_type;
+        if (filter_parameters.length() < 1) return eprosima::fastdds::dds::RETCODE_BAD_PARAMETER;
+        long us = std::atol(filter_parameters[0]);
+        if (us < 0) return eprosima::fastdds::dds::RETCODE_BAD_PARAMETER;
+
+        // filter_expression == nullptr: cambiano solo i parametri di un filtro che esiste già
+        MinSeparationFilter* filter = filter_expression == nullptr ? static_cast<MinSeparationFilter*>(filter_instance)
+                                                                   : new MinSeparationFilter();
+        filter->set_min_separation_us(us);
+        filter_instance = filter;
+        return eprosima::fastdds::dds::RETCODE_OK;
+    }
+
+    eprosima::fastdds::dds::ReturnCode_t delete_content_filter(const char* filter_class_name,
+            eprosima::fastdds::dds::IContentFilter* filter_instance) override {
+        (void) filter_class_name;
+        delete static_cast<MinSeparationFilter*>(filter_instance);
+        return eprosima::fastdds::dds::RETCODE_OK;
+    }
+};
+
+// si può chiamare più volte sullo stesso participant
+inline bool register_decimation_filter(eprosima::fastdds::dds::DomainParticipant* participant) {
+    static MinSeparationFilterFactory factory;
+    if (participant->lookup_content_filter_factory(TELEMETRY_DECIMATION_FILTER) != nullptr) return true;
+    return participant->register_content_filter_factory(TELEMETRY_DECIMATION_FILTER, &factory)
+           == eprosima::fastdds::dds::RETCODE_OK;
+}
+
+// Topic filtrato a max_rate_hz campioni al secondo sopra topic, nullptr se qualcosa non va
+inline eprosima::fastdds::dds::ContentFilteredTopic* create_decimated_topic(eprosima::fastdds::dds::DomainParticipant* participant,
+                                                                            eprosima::fastdds::dds::Topic* topic, double max_rate_hz) {
+    if (max_rate_hz <= 0.0 || !register_decimation_filter(participant)) return nullptr;
+    // il nome viene dalla separazione, non dagli Hz arrotondati: due tassi diversi non finiscono sullo stesso topic
+    std::string separation_us = std::to_string((long) (1e6 / max_rate_hz));
+    std::string name = topic->get_name() + "_min" + separation_us + "us";
+    std::vector<std::string> params = { separation_us };
+    return participant->create_contentfilteredtopic(name, topic, "min_separation_us = %0", params, TELEMETRY_DECIMATION_FILTER);
+}
+
+#endif
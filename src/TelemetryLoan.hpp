@@ -0,0 +1,98 @@
+//telemetria a copia zero: SystemStatsPlain è plain e a dimensione fissa, il writer presta il campione
+//(loan_sample), noi lo riempiamo sul posto e con il data-sharing il lettore sulla stessa macchina lo legge
+//dalla memoria condivisa del writer, niente serializzazione e niente copie nel trasporto
+//(vale anche per SystemStatsV2, che è plain). Il percorso si sceglie da cmake con -DFLIGHT_TELEMETRY= (COPY o LOAN),
+//publisher e MonitorApp devono usare lo stesso
+#ifndef TELEMETRY_LOAN_HPP
+#define TELEMETRY_LOAN_HPP
+
+#include "TelemetryPubSubTypes.hpp"
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <cstring>
+
+#if defined(FLIGHT_TELEMETRY_LOAN)
+constexpr bool TELEMETRY_LOAN = true;
+#else
+constexpr bool TELEMETRY_LOAN = false;
+#endif
+
+// tipi diversi vogliono topic diversi
+constexpr const char* TELEMETRY_TOPIC = "TelemetryTopic";
+constexpr const char* TELEMETRY_PLAIN_TOPIC = "TelemetryPlainTopic";
+
+// campioni che il writer tiene in memoria condivisa: un monitor lento ha 16 campioni di margine prima di perderli
+constexpr int32_t TELEMETRY_PLAIN_DEPTH = 16;
+
+// status_msg è un char[32]: copio al massimo 31 caratteri e azzero il resto, il campione prestato non è inizializzato
+inline void set_status_msg(SystemStatsPlain& stats, const char* msg) {
+    std::strncpy(stats.status_msg().data(), msg, stats.status_msg().size() - 1);
+    stats.status_msg().back() = '\0';
+}
+
+// Il monitor disegna SystemStats: converto il campione plain dopo averlo letto
+inline void copy_telemetry(const SystemStatsPlain& in, SystemStats& out) {
+    out.packet_id(in.packet_id());
+    out.roll(in.roll());
+    out.pitch(in.pitch());
+    out.yaw(in.yaw());
+    out.altitude(in.altitude());
+    out.latency_us(in.latency_us());
+    out.speed(in.speed());
+    out.deadline_missed(in.deadline_missed());
+    out.status_msg(in.status_msg().data());
+}
+
+// Il data-sharing vuole la storia preallocata: i campioni restano nel segmento del writer finché i lettori non li rilasciano
+inline void enable_data_sharing(eprosima::fastdds::dds::DataWriterQos& wqos) {
+    wqos.data_sharing().automatic();
+    wqos.endpoint().history_memory_policy = eprosima::fastdds::rtps::PREALLOCATED_MEMORY_MODE;
+    wqos.history().depth = TELEMETRY_PLAIN_DEPTH;
+}
+
+inline void enable_data_sharing(eprosima::fastdds::dds::DataReaderQos& rqos) {
+    rqos.data_sharing().automatic();
+    rqos.endpoint().history_memory_policy = eprosima::fastdds::rtps::PREALLOCATED_MEMORY_MODE;
+    rqos.history().depth = TELEMETRY_PLAIN_DEPTH;
+}
+
+// La v2 è già plain, si copia così com'è
+inline void copy_telemetry(const SystemStatsV2& in, SystemStatsV2& out) {
+    out = in;
+}
+
+// Prende un campione plain in prestito dal lettore (nessuna copia nel DataReader), lo converte e restituisce il prestito.
+// info è quella del campione (writer che l'ha pubblicato, istanza, ...)
+template <typename Plain, typename Out>
+inline bool take_telemetry_loaned(eprosima::fastdds::dds::DataReader* reader, Out& out, eprosima::fastdds::dds::SampleInfo& info,
+                                  void (*convert)(const Plain&, Out&)) {
+    using namespace eprosima::fastdds::dds;
+    LoanableSequence<Plain> data;
+    SampleInfoSeq infos;
+    if (reader->take(data, infos, 1) != RETCODE_OK) return false;
+    bool valid = data.length() > 0 && infos[0].valid_data;
+    if (valid) {
+        convert(data[0], out);
+        info = infos[0];
+    }
+    reader->return_loan(data, infos);
+    return valid;
+}
+
+// Legge il prossimo campione v1 con il percorso scelto da cmake
+inline bool take_telemetry(eprosima::fastdds::dds::DataReader* reader, SystemStats& out, eprosima::fastdds::dds::SampleInfo& info) {
+    if (TELEMETRY_LOAN) return take_telemetry_loaned<SystemStatsPlain>(reader, out, info, copy_telemetry);
+    return reader->take_next_sample(&out, &info) == eprosima::fastdds::dds::RETCODE_OK && info.valid_data;
+}
+
+// Stessa cosa per la v2
+inline bool take_telemetry(eprosima::fastdds::dds::DataReader* reader, SystemStatsV2& out, eprosima::fastdds::dds::SampleInfo& info) {
+    if (TELEMETRY_LOAN) return take_telemetry_loaned<SystemStatsV2>(reader, out, info, copy_telemetry);
+    return reader->take_next_sample(&out, &info) == eprosima::fastdds::dds::RETCODE_OK && info.valid_data;
+}
+
+#endif
@@ -344,3 +344,1211 @@ void register_SystemStats_type_identifier(
         }
     }
 }
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_SystemStatsPlain_type_identifier(
+        TypeIdentifierPair& type_ids_SystemStatsPlain)
+{
+
+    ReturnCode_t return_code_SystemStatsPlain {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_SystemStatsPlain =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "SystemStatsPlain", type_ids_SystemStatsPlain);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_SystemStatsPlain)
+    {
+        StructTypeFlag struct_flags_SystemStatsPlain = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::FINAL,
+                false, false);
+        QualifiedTypeName type_name_SystemStatsPlain = "SystemStatsPlain";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_SystemStatsPlain;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_SystemStatsPlain;
+        CompleteTypeDetail detail_SystemStatsPlain = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_SystemStatsPlain, ann_custom_SystemStatsPlain, type_name_SystemStatsPlain.to_string());
+        CompleteStructHeader header_SystemStatsPlain;
+        header_SystemStatsPlain = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_SystemStatsPlain);
+        CompleteStructMemberSeq member_seq_SystemStatsPlain;
+        {
+            TypeIdentifierPair type_ids_packet_id;
+            ReturnCode_t return_code_packet_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_packet_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_packet_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_packet_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "packet_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_packet_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_packet_id = 0x00000000;
+            bool common_packet_id_ec {false};
+            CommonStructMember common_packet_id {TypeObjectUtils::build_common_struct_member(member_id_packet_id, member_flags_packet_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_packet_id, common_packet_id_ec))};
+            if (!common_packet_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure packet_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_packet_id = "packet_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_packet_id;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_packet_id = TypeObjectUtils::build_complete_member_detail(name_packet_id, member_ann_builtin_packet_id, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_packet_id = TypeObjectUtils::build_complete_struct_member(common_packet_id, detail_packet_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_packet_id);
+        }
+        {
+            TypeIdentifierPair type_ids_roll;
+            ReturnCode_t return_code_roll {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_roll =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_roll);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_roll)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "roll Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_roll = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_roll = 0x00000001;
+            bool common_roll_ec {false};
+            CommonStructMember common_roll {TypeObjectUtils::build_common_struct_member(member_id_roll, member_flags_roll, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_roll, common_roll_ec))};
+            if (!common_roll_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure roll member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_roll = "roll";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_roll;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_roll = TypeObjectUtils::build_complete_member_detail(name_roll, member_ann_builtin_roll, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_roll = TypeObjectUtils::build_complete_struct_member(common_roll, detail_roll);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_roll);
+        }
+        {
+            TypeIdentifierPair type_ids_pitch;
+            ReturnCode_t return_code_pitch {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_pitch =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_pitch);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_pitch)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "pitch Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_pitch = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_pitch = 0x00000002;
+            bool common_pitch_ec {false};
+            CommonStructMember common_pitch {TypeObjectUtils::build_common_struct_member(member_id_pitch, member_flags_pitch, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_pitch, common_pitch_ec))};
+            if (!common_pitch_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure pitch member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_pitch = "pitch";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_pitch;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_pitch = TypeObjectUtils::build_complete_member_detail(name_pitch, member_ann_builtin_pitch, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_pitch = TypeObjectUtils::build_complete_struct_member(common_pitch, detail_pitch);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_pitch);
+        }
+        {
+            TypeIdentifierPair type_ids_yaw;
+            ReturnCode_t return_code_yaw {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_yaw =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_yaw);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_yaw)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "yaw Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_yaw = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_yaw = 0x00000003;
+            bool common_yaw_ec {false};
+            CommonStructMember common_yaw {TypeObjectUtils::build_common_struct_member(member_id_yaw, member_flags_yaw, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_yaw, common_yaw_ec))};
+            if (!common_yaw_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure yaw member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_yaw = "yaw";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_yaw;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_yaw = TypeObjectUtils::build_complete_member_detail(name_yaw, member_ann_builtin_yaw, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_yaw = TypeObjectUtils::build_complete_struct_member(common_yaw, detail_yaw);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_yaw);
+        }
+        {
+            TypeIdentifierPair type_ids_altitude;
+            ReturnCode_t return_code_altitude {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_altitude =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_altitude);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_altitude)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "altitude Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_altitude = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_altitude = 0x00000004;
+            bool common_altitude_ec {false};
+            CommonStructMember common_altitude {TypeObjectUtils::build_common_struct_member(member_id_altitude, member_flags_altitude, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_altitude, common_altitude_ec))};
+            if (!common_altitude_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure altitude member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_altitude = "altitude";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_altitude;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_altitude = TypeObjectUtils::build_complete_member_detail(name_altitude, member_ann_builtin_altitude, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_altitude = TypeObjectUtils::build_complete_struct_member(common_altitude, detail_altitude);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_altitude);
+        }
+        {
+            TypeIdentifierPair type_ids_latency_us;
+            ReturnCode_t return_code_latency_us {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_latency_us =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_latency_us);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_latency_us)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "latency_us Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_latency_us = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_latency_us = 0x00000005;
+            bool common_latency_us_ec {false};
+            CommonStructMember common_latency_us {TypeObjectUtils::build_common_struct_member(member_id_latency_us, member_flags_latency_us, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_latency_us, common_latency_us_ec))};
+            if (!common_latency_us_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure latency_us member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_latency_us = "latency_us";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_latency_us;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_latency_us = TypeObjectUtils::build_complete_member_detail(name_latency_us, member_ann_builtin_latency_us, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_latency_us = TypeObjectUtils::build_complete_struct_member(common_latency_us, detail_latency_us);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_latency_us);
+        }
+        {
+            TypeIdentifierPair type_ids_speed;
+            ReturnCode_t return_code_speed {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_speed =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_speed);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_speed)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "speed Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_speed = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_speed = 0x00000006;
+            bool common_speed_ec {false};
+            CommonStructMember common_speed {TypeObjectUtils::build_common_struct_member(member_id_speed, member_flags_speed, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_speed, common_speed_ec))};
+            if (!common_speed_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure speed member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_speed = "speed";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_speed;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_speed = TypeObjectUtils::build_complete_member_detail(name_speed, member_ann_builtin_speed, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_speed = TypeObjectUtils::build_complete_struct_member(common_speed, detail_speed);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_speed);
+        }
+        {
+            TypeIdentifierPair type_ids_deadline_missed;
+            ReturnCode_t return_code_deadline_missed {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_deadline_missed =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_bool", type_ids_deadline_missed);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_deadline_missed)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "deadline_missed Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_deadline_missed = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_deadline_missed = 0x00000007;
+            bool common_deadline_missed_ec {false};
+            CommonStructMember common_deadline_missed {TypeObjectUtils::build_common_struct_member(member_id_deadline_missed, member_flags_deadline_missed, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_deadline_missed, common_deadline_missed_ec))};
+            if (!common_deadline_missed_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure deadline_missed member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_deadline_missed = "deadline_missed";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_deadline_missed;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_deadline_missed = TypeObjectUtils::build_complete_member_detail(name_deadline_missed, member_ann_builtin_deadline_missed, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_deadline_missed = TypeObjectUtils::build_complete_struct_member(common_deadline_missed, detail_deadline_missed);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_deadline_missed);
+        }
+        {
+            TypeIdentifierPair type_ids_status_msg;
+            ReturnCode_t return_code_status_msg {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_status_msg =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "anonymous_array_char_32", type_ids_status_msg);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_status_msg)
+            {
+                return_code_status_msg =
+                    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                    "_char", type_ids_status_msg);
+
+                if (eprosima::fastdds::dds::RETCODE_OK != return_code_status_msg)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "Array element TypeIdentifier unknown to TypeObjectRegistry.");
+                    return;
+                }
+                bool element_identifier_anonymous_array_char_32_ec {false};
+                TypeIdentifier* element_identifier_anonymous_array_char_32 {new TypeIdentifier(TypeObjectUtils::retrieve_complete_type_identifier(type_ids_status_msg, element_identifier_anonymous_array_char_32_ec))};
+                if (!element_identifier_anonymous_array_char_32_ec)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Array element TypeIdentifier inconsistent.");
+                    return;
+                }
+                EquivalenceKind equiv_kind_anonymous_array_char_32 = EK_COMPLETE;
+                if (TK_NONE == type_ids_status_msg.type_identifier2()._d())
+                {
+                    equiv_kind_anonymous_array_char_32 = EK_BOTH;
+                }
+                CollectionElementFlag element_flags_anonymous_array_char_32 = 0;
+                PlainCollectionHeader header_anonymous_array_char_32 = TypeObjectUtils::build_plain_collection_header(equiv_kind_anonymous_array_char_32, element_flags_anonymous_array_char_32);
+                {
+                    SBoundSeq array_bound_seq;
+                        TypeObjectUtils::add_array_dimension(array_bound_seq, static_cast<SBound>(32));
+
+                    PlainArraySElemDefn array_sdefn = TypeObjectUtils::build_plain_array_s_elem_defn(header_anonymous_array_char_32, array_bound_seq,
+                                eprosima::fastcdr::external<TypeIdentifier>(element_identifier_anonymous_array_char_32));
+                    if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                            TypeObjectUtils::build_and_register_s_array_type_identifier(array_sdefn, "anonymous_array_char_32", type_ids_status_msg))
+                    {
+                        EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "anonymous_array_char_32 already registered in TypeObjectRegistry for a different type.");
+                    }
+                }
+            }
+            StructMemberFlag member_flags_status_msg = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_status_msg = 0x00000008;
+            bool common_status_msg_ec {false};
+            CommonStructMember common_status_msg {TypeObjectUtils::build_common_struct_member(member_id_status_msg, member_flags_status_msg, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_status_msg, common_status_msg_ec))};
+            if (!common_status_msg_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure status_msg member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_status_msg = "status_msg";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_status_msg;
+            ann_custom_SystemStatsPlain.reset();
+            CompleteMemberDetail detail_status_msg = TypeObjectUtils::build_complete_member_detail(name_status_msg, member_ann_builtin_status_msg, ann_custom_SystemStatsPlain);
+            CompleteStructMember member_status_msg = TypeObjectUtils::build_complete_struct_member(common_status_msg, detail_status_msg);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsPlain, member_status_msg);
+        }
+        CompleteStructType struct_type_SystemStatsPlain = TypeObjectUtils::build_complete_struct_type(struct_flags_SystemStatsPlain, header_SystemStatsPlain, member_seq_SystemStatsPlain);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_SystemStatsPlain, type_name_SystemStatsPlain.to_string(), type_ids_SystemStatsPlain))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "SystemStatsPlain already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+void register_FlightStatus_type_identifier(
+        TypeIdentifierPair& type_ids_FlightStatus)
+{
+    ReturnCode_t return_code_FlightStatus {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_FlightStatus =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "FlightStatus", type_ids_FlightStatus);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_FlightStatus)
+    {
+        EnumTypeFlag enum_flags_FlightStatus = 0;
+        BitBound bit_bound_FlightStatus = 32;
+        CommonEnumeratedHeader common_FlightStatus = TypeObjectUtils::build_common_enumerated_header(bit_bound_FlightStatus);
+        QualifiedTypeName type_name_FlightStatus = "FlightStatus";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_FlightStatus;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_FlightStatus;
+        CompleteTypeDetail detail_FlightStatus = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_FlightStatus, ann_custom_FlightStatus, type_name_FlightStatus.to_string());
+        CompleteEnumeratedHeader header_FlightStatus = TypeObjectUtils::build_complete_enumerated_header(common_FlightStatus, detail_FlightStatus);
+        CompleteEnumeratedLiteralSeq literal_seq_FlightStatus;
+        {
+            EnumeratedLiteralFlag flags_FlightStatus_NOMINAL_FLIGHT = TypeObjectUtils::build_enumerated_literal_flag(true);
+            CommonEnumeratedLiteral common_FlightStatus_NOMINAL_FLIGHT = TypeObjectUtils::build_common_enumerated_literal(0, flags_FlightStatus_NOMINAL_FLIGHT);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FlightStatus_NOMINAL_FLIGHT;
+            ann_custom_FlightStatus.reset();
+            MemberName name_FlightStatus_NOMINAL_FLIGHT = "NOMINAL_FLIGHT";
+            CompleteMemberDetail detail_FlightStatus_NOMINAL_FLIGHT = TypeObjectUtils::build_complete_member_detail(name_FlightStatus_NOMINAL_FLIGHT, member_ann_builtin_FlightStatus_NOMINAL_FLIGHT, ann_custom_FlightStatus);
+            CompleteEnumeratedLiteral literal_FlightStatus_NOMINAL_FLIGHT = TypeObjectUtils::build_complete_enumerated_literal(common_FlightStatus_NOMINAL_FLIGHT, detail_FlightStatus_NOMINAL_FLIGHT);
+            TypeObjectUtils::add_complete_enumerated_literal(literal_seq_FlightStatus, literal_FlightStatus_NOMINAL_FLIGHT);
+        }
+        {
+            EnumeratedLiteralFlag flags_FlightStatus_AUTOPILOT_RECOVERY = TypeObjectUtils::build_enumerated_literal_flag(false);
+            CommonEnumeratedLiteral common_FlightStatus_AUTOPILOT_RECOVERY = TypeObjectUtils::build_common_enumerated_literal(1, flags_FlightStatus_AUTOPILOT_RECOVERY);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FlightStatus_AUTOPILOT_RECOVERY;
+            ann_custom_FlightStatus.reset();
+            MemberName name_FlightStatus_AUTOPILOT_RECOVERY = "AUTOPILOT_RECOVERY";
+            CompleteMemberDetail detail_FlightStatus_AUTOPILOT_RECOVERY = TypeObjectUtils::build_complete_member_detail(name_FlightStatus_AUTOPILOT_RECOVERY, member_ann_builtin_FlightStatus_AUTOPILOT_RECOVERY, ann_custom_FlightStatus);
+            CompleteEnumeratedLiteral literal_FlightStatus_AUTOPILOT_RECOVERY = TypeObjectUtils::build_complete_enumerated_literal(common_FlightStatus_AUTOPILOT_RECOVERY, detail_FlightStatus_AUTOPILOT_RECOVERY);
+            TypeObjectUtils::add_complete_enumerated_literal(literal_seq_FlightStatus, literal_FlightStatus_AUTOPILOT_RECOVERY);
+        }
+        {
+            EnumeratedLiteralFlag flags_FlightStatus_WARN_HIGH_BANK = TypeObjectUtils::build_enumerated_literal_flag(false);
+            CommonEnumeratedLiteral common_FlightStatus_WARN_HIGH_BANK = TypeObjectUtils::build_common_enumerated_literal(2, flags_FlightStatus_WARN_HIGH_BANK);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FlightStatus_WARN_HIGH_BANK;
+            ann_custom_FlightStatus.reset();
+            MemberName name_FlightStatus_WARN_HIGH_BANK = "WARN_HIGH_BANK";
+            CompleteMemberDetail detail_FlightStatus_WARN_HIGH_BANK = TypeObjectUtils::build_complete_member_detail(name_FlightStatus_WARN_HIGH_BANK, member_ann_builtin_FlightStatus_WARN_HIGH_BANK, ann_custom_FlightStatus);
+            CompleteEnumeratedLiteral literal_FlightStatus_WARN_HIGH_BANK = TypeObjectUtils::build_complete_enumerated_literal(common_FlightStatus_WARN_HIGH_BANK, detail_FlightStatus_WARN_HIGH_BANK);
+            TypeObjectUtils::add_complete_enumerated_literal(literal_seq_FlightStatus, literal_FlightStatus_WARN_HIGH_BANK);
+        }
+        {
+            EnumeratedLiteralFlag flags_FlightStatus_ALARM_TERRAIN_PULL_UP = TypeObjectUtils::build_enumerated_literal_flag(false);
+            CommonEnumeratedLiteral common_FlightStatus_ALARM_TERRAIN_PULL_UP = TypeObjectUtils::build_common_enumerated_literal(3, flags_FlightStatus_ALARM_TERRAIN_PULL_UP);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FlightStatus_ALARM_TERRAIN_PULL_UP;
+            ann_custom_FlightStatus.reset();
+            MemberName name_FlightStatus_ALARM_TERRAIN_PULL_UP = "ALARM_TERRAIN_PULL_UP";
+            CompleteMemberDetail detail_FlightStatus_ALARM_TERRAIN_PULL_UP = TypeObjectUtils::build_complete_member_detail(name_FlightStatus_ALARM_TERRAIN_PULL_UP, member_ann_builtin_FlightStatus_ALARM_TERRAIN_PULL_UP, ann_custom_FlightStatus);
+            CompleteEnumeratedLiteral literal_FlightStatus_ALARM_TERRAIN_PULL_UP = TypeObjectUtils::build_complete_enumerated_literal(common_FlightStatus_ALARM_TERRAIN_PULL_UP, detail_FlightStatus_ALARM_TERRAIN_PULL_UP);
+            TypeObjectUtils::add_complete_enumerated_literal(literal_seq_FlightStatus, literal_FlightStatus_ALARM_TERRAIN_PULL_UP);
+        }
+        {
+            EnumeratedLiteralFlag flags_FlightStatus_ALARM_HIGH_ALTITUDE = TypeObjectUtils::build_enumerated_literal_flag(false);
+            CommonEnumeratedLiteral common_FlightStatus_ALARM_HIGH_ALTITUDE = TypeObjectUtils::build_common_enumerated_literal(4, flags_FlightStatus_ALARM_HIGH_ALTITUDE);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FlightStatus_ALARM_HIGH_ALTITUDE;
+            ann_custom_FlightStatus.reset();
+            MemberName name_FlightStatus_ALARM_HIGH_ALTITUDE = "ALARM_HIGH_ALTITUDE";
+            CompleteMemberDetail detail_FlightStatus_ALARM_HIGH_ALTITUDE = TypeObjectUtils::build_complete_member_detail(name_FlightStatus_ALARM_HIGH_ALTITUDE, member_ann_builtin_FlightStatus_ALARM_HIGH_ALTITUDE, ann_custom_FlightStatus);
+            CompleteEnumeratedLiteral literal_FlightStatus_ALARM_HIGH_ALTITUDE = TypeObjectUtils::build_complete_enumerated_literal(common_FlightStatus_ALARM_HIGH_ALTITUDE, detail_FlightStatus_ALARM_HIGH_ALTITUDE);
+            TypeObjectUtils::add_complete_enumerated_literal(literal_seq_FlightStatus, literal_FlightStatus_ALARM_HIGH_ALTITUDE);
+        }
+        CompleteEnumeratedType enumerated_type_FlightStatus = TypeObjectUtils::build_complete_enumerated_type(enum_flags_FlightStatus, header_FlightStatus,
+                literal_seq_FlightStatus);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_enumerated_type_object(enumerated_type_FlightStatus, type_name_FlightStatus.to_string(), type_ids_FlightStatus))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                "FlightStatus already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+void register_TelemetryFlags_type_identifier(
+        TypeIdentifierPair& type_ids_TelemetryFlags)
+{
+    ReturnCode_t return_code_TelemetryFlags {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_TelemetryFlags =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "TelemetryFlags", type_ids_TelemetryFlags);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_TelemetryFlags)
+    {
+        BitmaskTypeFlag bitmask_flags_TelemetryFlags = 0;
+        BitBound bit_bound_TelemetryFlags = 8;
+        CommonEnumeratedHeader common_TelemetryFlags = TypeObjectUtils::build_common_enumerated_header(bit_bound_TelemetryFlags, true);
+        QualifiedTypeName type_name_TelemetryFlags = "TelemetryFlags";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_TelemetryFlags;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_TelemetryFlags;
+        CompleteTypeDetail detail_TelemetryFlags = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_TelemetryFlags, ann_custom_TelemetryFlags, type_name_TelemetryFlags.to_string());
+        CompleteEnumeratedHeader header_TelemetryFlags = TypeObjectUtils::build_complete_enumerated_header(common_TelemetryFlags, detail_TelemetryFlags, true);
+        CompleteBitflagSeq flag_seq_TelemetryFlags;
+        {
+            BitflagFlag flags_FLAG_DEADLINE_MISSED = 0;
+            CommonBitflag common_FLAG_DEADLINE_MISSED = TypeObjectUtils::build_common_bitflag(0, flags_FLAG_DEADLINE_MISSED);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FLAG_DEADLINE_MISSED;
+            ann_custom_TelemetryFlags.reset();
+            MemberName name_FLAG_DEADLINE_MISSED = "FLAG_DEADLINE_MISSED";
+            CompleteMemberDetail detail_FLAG_DEADLINE_MISSED = TypeObjectUtils::build_complete_member_detail(name_FLAG_DEADLINE_MISSED, member_ann_builtin_FLAG_DEADLINE_MISSED, ann_custom_TelemetryFlags);
+            CompleteBitflag bitflag_FLAG_DEADLINE_MISSED = TypeObjectUtils::build_complete_bitflag(common_FLAG_DEADLINE_MISSED, detail_FLAG_DEADLINE_MISSED);
+            TypeObjectUtils::add_complete_bitflag(flag_seq_TelemetryFlags, bitflag_FLAG_DEADLINE_MISSED);
+        }
+        {
+            BitflagFlag flags_FLAG_AUTOPILOT = 0;
+            CommonBitflag common_FLAG_AUTOPILOT = TypeObjectUtils::build_common_bitflag(1, flags_FLAG_AUTOPILOT);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FLAG_AUTOPILOT;
+            ann_custom_TelemetryFlags.reset();
+            MemberName name_FLAG_AUTOPILOT = "FLAG_AUTOPILOT";
+            CompleteMemberDetail detail_FLAG_AUTOPILOT = TypeObjectUtils::build_complete_member_detail(name_FLAG_AUTOPILOT, member_ann_builtin_FLAG_AUTOPILOT, ann_custom_TelemetryFlags);
+            CompleteBitflag bitflag_FLAG_AUTOPILOT = TypeObjectUtils::build_complete_bitflag(common_FLAG_AUTOPILOT, detail_FLAG_AUTOPILOT);
+            TypeObjectUtils::add_complete_bitflag(flag_seq_TelemetryFlags, bitflag_FLAG_AUTOPILOT);
+        }
+        {
+            BitflagFlag flags_FLAG_RECOVERY_BANK = 0;
+            CommonBitflag common_FLAG_RECOVERY_BANK = TypeObjectUtils::build_common_bitflag(2, flags_FLAG_RECOVERY_BANK);
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_FLAG_RECOVERY_BANK;
+            ann_custom_TelemetryFlags.reset();
+            MemberName name_FLAG_RECOVERY_BANK = "FLAG_RECOVERY_BANK";
+            CompleteMemberDetail detail_FLAG_RECOVERY_BANK = TypeObjectUtils::build_complete_member_detail(name_FLAG_RECOVERY_BANK, member_ann_builtin_FLAG_RECOVERY_BANK, ann_custom_TelemetryFlags);
+            CompleteBitflag bitflag_FLAG_RECOVERY_BANK = TypeObjectUtils::build_complete_bitflag(common_FLAG_RECOVERY_BANK, detail_FLAG_RECOVERY_BANK);
+            TypeObjectUtils::add_complete_bitflag(flag_seq_TelemetryFlags, bitflag_FLAG_RECOVERY_BANK);
+        }
+        CompleteBitmaskType bitmask_type_TelemetryFlags = TypeObjectUtils::build_complete_bitmask_type(bitmask_flags_TelemetryFlags, header_TelemetryFlags, flag_seq_TelemetryFlags);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_bitmask_type_object(bitmask_type_TelemetryFlags,
+                type_name_TelemetryFlags.to_string(), type_ids_TelemetryFlags))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                "TelemetryFlags already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_SystemStatsV2_type_identifier(
+        TypeIdentifierPair& type_ids_SystemStatsV2)
+{
+
+    ReturnCode_t return_code_SystemStatsV2 {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_SystemStatsV2 =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "SystemStatsV2", type_ids_SystemStatsV2);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_SystemStatsV2)
+    {
+        StructTypeFlag struct_flags_SystemStatsV2 = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::FINAL,
+                false, false);
+        QualifiedTypeName type_name_SystemStatsV2 = "SystemStatsV2";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_SystemStatsV2;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_SystemStatsV2;
+        CompleteTypeDetail detail_SystemStatsV2 = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_SystemStatsV2, ann_custom_SystemStatsV2, type_name_SystemStatsV2.to_string());
+        CompleteStructHeader header_SystemStatsV2;
+        header_SystemStatsV2 = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_SystemStatsV2);
+        CompleteStructMemberSeq member_seq_SystemStatsV2;
+        {
+            TypeIdentifierPair type_ids_packet_id;
+            ReturnCode_t return_code_packet_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_packet_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_packet_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_packet_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "packet_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_packet_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_packet_id = 0x00000000;
+            bool common_packet_id_ec {false};
+            CommonStructMember common_packet_id {TypeObjectUtils::build_common_struct_member(member_id_packet_id, member_flags_packet_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_packet_id, common_packet_id_ec))};
+            if (!common_packet_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure packet_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_packet_id = "packet_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_packet_id;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_packet_id = TypeObjectUtils::build_complete_member_detail(name_packet_id, member_ann_builtin_packet_id, ann_custom_SystemStatsV2);
+            CompleteStructMember member_packet_id = TypeObjectUtils::build_complete_struct_member(common_packet_id, detail_packet_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_packet_id);
+        }
+        {
+            TypeIdentifierPair type_ids_roll;
+            ReturnCode_t return_code_roll {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_roll =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_roll);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_roll)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "roll Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_roll = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_roll = 0x00000001;
+            bool common_roll_ec {false};
+            CommonStructMember common_roll {TypeObjectUtils::build_common_struct_member(member_id_roll, member_flags_roll, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_roll, common_roll_ec))};
+            if (!common_roll_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure roll member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_roll = "roll";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_roll;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_roll = TypeObjectUtils::build_complete_member_detail(name_roll, member_ann_builtin_roll, ann_custom_SystemStatsV2);
+            CompleteStructMember member_roll = TypeObjectUtils::build_complete_struct_member(common_roll, detail_roll);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_roll);
+        }
+        {
+            TypeIdentifierPair type_ids_pitch;
+            ReturnCode_t return_code_pitch {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_pitch =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_pitch);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_pitch)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "pitch Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_pitch = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_pitch = 0x00000002;
+            bool common_pitch_ec {false};
+            CommonStructMember common_pitch {TypeObjectUtils::build_common_struct_member(member_id_pitch, member_flags_pitch, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_pitch, common_pitch_ec))};
+            if (!common_pitch_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure pitch member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_pitch = "pitch";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_pitch;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_pitch = TypeObjectUtils::build_complete_member_detail(name_pitch, member_ann_builtin_pitch, ann_custom_SystemStatsV2);
+            CompleteStructMember member_pitch = TypeObjectUtils::build_complete_struct_member(common_pitch, detail_pitch);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_pitch);
+        }
+        {
+            TypeIdentifierPair type_ids_yaw;
+            ReturnCode_t return_code_yaw {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_yaw =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_yaw);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_yaw)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "yaw Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_yaw = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_yaw = 0x00000003;
+            bool common_yaw_ec {false};
+            CommonStructMember common_yaw {TypeObjectUtils::build_common_struct_member(member_id_yaw, member_flags_yaw, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_yaw, common_yaw_ec))};
+            if (!common_yaw_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure yaw member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_yaw = "yaw";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_yaw;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_yaw = TypeObjectUtils::build_complete_member_detail(name_yaw, member_ann_builtin_yaw, ann_custom_SystemStatsV2);
+            CompleteStructMember member_yaw = TypeObjectUtils::build_complete_struct_member(common_yaw, detail_yaw);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_yaw);
+        }
+        {
+            TypeIdentifierPair type_ids_altitude;
+            ReturnCode_t return_code_altitude {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_altitude =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_altitude);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_altitude)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "altitude Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_altitude = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_altitude = 0x00000004;
+            bool common_altitude_ec {false};
+            CommonStructMember common_altitude {TypeObjectUtils::build_common_struct_member(member_id_altitude, member_flags_altitude, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_altitude, common_altitude_ec))};
+            if (!common_altitude_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure altitude member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_altitude = "altitude";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_altitude;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_altitude = TypeObjectUtils::build_complete_member_detail(name_altitude, member_ann_builtin_altitude, ann_custom_SystemStatsV2);
+            CompleteStructMember member_altitude = TypeObjectUtils::build_complete_struct_member(common_altitude, detail_altitude);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_altitude);
+        }
+        {
+            TypeIdentifierPair type_ids_speed;
+            ReturnCode_t return_code_speed {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_speed =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_speed);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_speed)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "speed Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_speed = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_speed = 0x00000005;
+            bool common_speed_ec {false};
+            CommonStructMember common_speed {TypeObjectUtils::build_common_struct_member(member_id_speed, member_flags_speed, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_speed, common_speed_ec))};
+            if (!common_speed_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure speed member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_speed = "speed";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_speed;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_speed = TypeObjectUtils::build_complete_member_detail(name_speed, member_ann_builtin_speed, ann_custom_SystemStatsV2);
+            CompleteStructMember member_speed = TypeObjectUtils::build_complete_struct_member(common_speed, detail_speed);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_speed);
+        }
+        {
+            TypeIdentifierPair type_ids_status;
+            ReturnCode_t return_code_status {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_status =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "FlightStatus", type_ids_status);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_status)
+            {
+            ::register_FlightStatus_type_identifier(type_ids_status);
+            }
+            StructMemberFlag member_flags_status = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_status = 0x00000006;
+            bool common_status_ec {false};
+            CommonStructMember common_status {TypeObjectUtils::build_common_struct_member(member_id_status, member_flags_status, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_status, common_status_ec))};
+            if (!common_status_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure status member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_status = "status";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_status;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_status = TypeObjectUtils::build_complete_member_detail(name_status, member_ann_builtin_status, ann_custom_SystemStatsV2);
+            CompleteStructMember member_status = TypeObjectUtils::build_complete_struct_member(common_status, detail_status);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_status);
+        }
+        {
+            TypeIdentifierPair type_ids_latency_us;
+            ReturnCode_t return_code_latency_us {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_latency_us =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint16_t", type_ids_latency_us);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_latency_us)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "latency_us Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_latency_us = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_latency_us = 0x00000007;
+            bool common_latency_us_ec {false};
+            CommonStructMember common_latency_us {TypeObjectUtils::build_common_struct_member(member_id_latency_us, member_flags_latency_us, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_latency_us, common_latency_us_ec))};
+            if (!common_latency_us_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure latency_us member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_latency_us = "latency_us";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_latency_us;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_latency_us = TypeObjectUtils::build_complete_member_detail(name_latency_us, member_ann_builtin_latency_us, ann_custom_SystemStatsV2);
+            CompleteStructMember member_latency_us = TypeObjectUtils::build_complete_struct_member(common_latency_us, detail_latency_us);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_latency_us);
+        }
+        {
+            TypeIdentifierPair type_ids_flags;
+            ReturnCode_t return_code_flags {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_flags =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "TelemetryFlags", type_ids_flags);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_flags)
+            {
+            ::register_TelemetryFlags_type_identifier(type_ids_flags);
+            }
+            StructMemberFlag member_flags_flags = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_flags = 0x00000008;
+            bool common_flags_ec {false};
+            CommonStructMember common_flags {TypeObjectUtils::build_common_struct_member(member_id_flags, member_flags_flags, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_flags, common_flags_ec))};
+            if (!common_flags_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure flags member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_flags = "flags";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_flags;
+            ann_custom_SystemStatsV2.reset();
+            CompleteMemberDetail detail_flags = TypeObjectUtils::build_complete_member_detail(name_flags, member_ann_builtin_flags, ann_custom_SystemStatsV2);
+            CompleteStructMember member_flags = TypeObjectUtils::build_complete_struct_member(common_flags, detail_flags);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsV2, member_flags);
+        }
+        CompleteStructType struct_type_SystemStatsV2 = TypeObjectUtils::build_complete_struct_type(struct_flags_SystemStatsV2, header_SystemStatsV2, member_seq_SystemStatsV2);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_SystemStatsV2, type_name_SystemStatsV2.to_string(), type_ids_SystemStatsV2))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "SystemStatsV2 already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_SystemStatsBatch_type_identifier(
+        TypeIdentifierPair& type_ids_SystemStatsBatch)
+{
+
+    ReturnCode_t return_code_SystemStatsBatch {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_SystemStatsBatch =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "SystemStatsBatch", type_ids_SystemStatsBatch);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_SystemStatsBatch)
+    {
+        StructTypeFlag struct_flags_SystemStatsBatch = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::APPENDABLE,
+                false, false);
+        QualifiedTypeName type_name_SystemStatsBatch = "SystemStatsBatch";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_SystemStatsBatch;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_SystemStatsBatch;
+        CompleteTypeDetail detail_SystemStatsBatch = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_SystemStatsBatch, ann_custom_SystemStatsBatch, type_name_SystemStatsBatch.to_string());
+        CompleteStructHeader header_SystemStatsBatch;
+        header_SystemStatsBatch = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_SystemStatsBatch);
+        CompleteStructMemberSeq member_seq_SystemStatsBatch;
+        {
+            TypeIdentifierPair type_ids_batch_id;
+            ReturnCode_t return_code_batch_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_batch_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_batch_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_batch_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "batch_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_batch_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_batch_id = 0x00000000;
+            bool common_batch_id_ec {false};
+            CommonStructMember common_batch_id {TypeObjectUtils::build_common_struct_member(member_id_batch_id, member_flags_batch_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_batch_id, common_batch_id_ec))};
+            if (!common_batch_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure batch_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_batch_id = "batch_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_batch_id;
+            ann_custom_SystemStatsBatch.reset();
+            CompleteMemberDetail detail_batch_id = TypeObjectUtils::build_complete_member_detail(name_batch_id, member_ann_builtin_batch_id, ann_custom_SystemStatsBatch);
+            CompleteStructMember member_batch_id = TypeObjectUtils::build_complete_struct_member(common_batch_id, detail_batch_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsBatch, member_batch_id);
+        }
+        {
+            TypeIdentifierPair type_ids_samples;
+            ReturnCode_t return_code_samples {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_samples =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "anonymous_sequence_SystemStatsV2_256", type_ids_samples);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_samples)
+            {
+                return_code_samples =
+                    eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                    "SystemStatsV2", type_ids_samples);
+
+                if (eprosima::fastdds::dds::RETCODE_OK != return_code_samples)
+                {
+                ::register_SystemStatsV2_type_identifier(type_ids_samples);
+                }
+                bool element_identifier_anonymous_sequence_SystemStatsV2_256_ec {false};
+                TypeIdentifier* element_identifier_anonymous_sequence_SystemStatsV2_256 {new TypeIdentifier(TypeObjectUtils::retrieve_complete_type_identifier(type_ids_samples, element_identifier_anonymous_sequence_SystemStatsV2_256_ec))};
+                if (!element_identifier_anonymous_sequence_SystemStatsV2_256_ec)
+                {
+                    EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Sequence element TypeIdentifier inconsistent.");
+                    return;
+                }
+                EquivalenceKind equiv_kind_anonymous_sequence_SystemStatsV2_256 = EK_COMPLETE;
+                if (TK_NONE == type_ids_samples.type_identifier2()._d())
+                {
+                    equiv_kind_anonymous_sequence_SystemStatsV2_256 = EK_BOTH;
+                }
+                CollectionElementFlag element_flags_anonymous_sequence_SystemStatsV2_256 = 0;
+                PlainCollectionHeader header_anonymous_sequence_SystemStatsV2_256 = TypeObjectUtils::build_plain_collection_header(equiv_kind_anonymous_sequence_SystemStatsV2_256, element_flags_anonymous_sequence_SystemStatsV2_256);
+                {
+                    SBound bound = static_cast<SBound>(256);
+                    PlainSequenceSElemDefn seq_sdefn = TypeObjectUtils::build_plain_sequence_s_elem_defn(header_anonymous_sequence_SystemStatsV2_256, bound,
+                                eprosima::fastcdr::external<TypeIdentifier>(element_identifier_anonymous_sequence_SystemStatsV2_256));
+                    if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                            TypeObjectUtils::build_and_register_s_sequence_type_identifier(seq_sdefn, "anonymous_sequence_SystemStatsV2_256", type_ids_samples))
+                    {
+                        EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                            "anonymous_sequence_SystemStatsV2_256 already registered in TypeObjectRegistry for a different type.");
+                    }
+                }
+            }
+            StructMemberFlag member_flags_samples = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_samples = 0x00000001;
+            bool common_samples_ec {false};
+            CommonStructMember common_samples {TypeObjectUtils::build_common_struct_member(member_id_samples, member_flags_samples, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_samples, common_samples_ec))};
+            if (!common_samples_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure samples member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_samples = "samples";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_samples;
+            ann_custom_SystemStatsBatch.reset();
+            CompleteMemberDetail detail_samples = TypeObjectUtils::build_complete_member_detail(name_samples, member_ann_builtin_samples, ann_custom_SystemStatsBatch);
+            CompleteStructMember member_samples = TypeObjectUtils::build_complete_struct_member(common_samples, detail_samples);
+            TypeObjectUtils::add_complete_struct_member(member_seq_SystemStatsBatch, member_samples);
+        }
+        CompleteStructType struct_type_SystemStatsBatch = TypeObjectUtils::build_complete_struct_type(struct_flags_SystemStatsBatch, header_SystemStatsBatch, member_seq_SystemStatsBatch);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_SystemStatsBatch, type_name_SystemStatsBatch.to_string(), type_ids_SystemStatsBatch))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "SystemStatsBatch already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
+// TypeIdentifier is returned by reference: dependent structures/unions are registered in this same method
+void register_AircraftTelemetry_type_identifier(
+        TypeIdentifierPair& type_ids_AircraftTelemetry)
+{
+
+    ReturnCode_t return_code_AircraftTelemetry {eprosima::fastdds::dds::RETCODE_OK};
+    return_code_AircraftTelemetry =
+        eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        "AircraftTelemetry", type_ids_AircraftTelemetry);
+    if (eprosima::fastdds::dds::RETCODE_OK != return_code_AircraftTelemetry)
+    {
+        StructTypeFlag struct_flags_AircraftTelemetry = TypeObjectUtils::build_struct_type_flag(eprosima::fastdds::dds::xtypes::ExtensibilityKind::FINAL,
+                false, false);
+        QualifiedTypeName type_name_AircraftTelemetry = "AircraftTelemetry";
+        eprosima::fastcdr::optional<AppliedBuiltinTypeAnnotations> type_ann_builtin_AircraftTelemetry;
+        eprosima::fastcdr::optional<AppliedAnnotationSeq> ann_custom_AircraftTelemetry;
+        CompleteTypeDetail detail_AircraftTelemetry = TypeObjectUtils::build_complete_type_detail(type_ann_builtin_AircraftTelemetry, ann_custom_AircraftTelemetry, type_name_AircraftTelemetry.to_string());
+        CompleteStructHeader header_AircraftTelemetry;
+        header_AircraftTelemetry = TypeObjectUtils::build_complete_struct_header(TypeIdentifier(), detail_AircraftTelemetry);
+        CompleteStructMemberSeq member_seq_AircraftTelemetry;
+        {
+            TypeIdentifierPair type_ids_aircraft_id;
+            ReturnCode_t return_code_aircraft_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_aircraft_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_aircraft_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_aircraft_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "aircraft_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_aircraft_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, true, false);
+            MemberId member_id_aircraft_id = 0x00000000;
+            bool common_aircraft_id_ec {false};
+            CommonStructMember common_aircraft_id {TypeObjectUtils::build_common_struct_member(member_id_aircraft_id, member_flags_aircraft_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_aircraft_id, common_aircraft_id_ec))};
+            if (!common_aircraft_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure aircraft_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_aircraft_id = "aircraft_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_aircraft_id;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_aircraft_id = TypeObjectUtils::build_complete_member_detail(name_aircraft_id, member_ann_builtin_aircraft_id, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_aircraft_id = TypeObjectUtils::build_complete_struct_member(common_aircraft_id, detail_aircraft_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_aircraft_id);
+        }
+        {
+            TypeIdentifierPair type_ids_packet_id;
+            ReturnCode_t return_code_packet_id {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_packet_id =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint32_t", type_ids_packet_id);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_packet_id)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "packet_id Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_packet_id = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_packet_id = 0x00000001;
+            bool common_packet_id_ec {false};
+            CommonStructMember common_packet_id {TypeObjectUtils::build_common_struct_member(member_id_packet_id, member_flags_packet_id, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_packet_id, common_packet_id_ec))};
+            if (!common_packet_id_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure packet_id member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_packet_id = "packet_id";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_packet_id;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_packet_id = TypeObjectUtils::build_complete_member_detail(name_packet_id, member_ann_builtin_packet_id, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_packet_id = TypeObjectUtils::build_complete_struct_member(common_packet_id, detail_packet_id);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_packet_id);
+        }
+        {
+            TypeIdentifierPair type_ids_roll;
+            ReturnCode_t return_code_roll {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_roll =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_roll);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_roll)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "roll Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_roll = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_roll = 0x00000002;
+            bool common_roll_ec {false};
+            CommonStructMember common_roll {TypeObjectUtils::build_common_struct_member(member_id_roll, member_flags_roll, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_roll, common_roll_ec))};
+            if (!common_roll_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure roll member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_roll = "roll";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_roll;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_roll = TypeObjectUtils::build_complete_member_detail(name_roll, member_ann_builtin_roll, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_roll = TypeObjectUtils::build_complete_struct_member(common_roll, detail_roll);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_roll);
+        }
+        {
+            TypeIdentifierPair type_ids_pitch;
+            ReturnCode_t return_code_pitch {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_pitch =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_pitch);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_pitch)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "pitch Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_pitch = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_pitch = 0x00000003;
+            bool common_pitch_ec {false};
+            CommonStructMember common_pitch {TypeObjectUtils::build_common_struct_member(member_id_pitch, member_flags_pitch, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_pitch, common_pitch_ec))};
+            if (!common_pitch_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure pitch member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_pitch = "pitch";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_pitch;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_pitch = TypeObjectUtils::build_complete_member_detail(name_pitch, member_ann_builtin_pitch, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_pitch = TypeObjectUtils::build_complete_struct_member(common_pitch, detail_pitch);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_pitch);
+        }
+        {
+            TypeIdentifierPair type_ids_yaw;
+            ReturnCode_t return_code_yaw {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_yaw =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_yaw);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_yaw)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "yaw Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_yaw = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_yaw = 0x00000004;
+            bool common_yaw_ec {false};
+            CommonStructMember common_yaw {TypeObjectUtils::build_common_struct_member(member_id_yaw, member_flags_yaw, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_yaw, common_yaw_ec))};
+            if (!common_yaw_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure yaw member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_yaw = "yaw";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_yaw;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_yaw = TypeObjectUtils::build_complete_member_detail(name_yaw, member_ann_builtin_yaw, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_yaw = TypeObjectUtils::build_complete_struct_member(common_yaw, detail_yaw);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_yaw);
+        }
+        {
+            TypeIdentifierPair type_ids_altitude;
+            ReturnCode_t return_code_altitude {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_altitude =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_altitude);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_altitude)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "altitude Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_altitude = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_altitude = 0x00000005;
+            bool common_altitude_ec {false};
+            CommonStructMember common_altitude {TypeObjectUtils::build_common_struct_member(member_id_altitude, member_flags_altitude, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_altitude, common_altitude_ec))};
+            if (!common_altitude_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure altitude member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_altitude = "altitude";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_altitude;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_altitude = TypeObjectUtils::build_complete_member_detail(name_altitude, member_ann_builtin_altitude, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_altitude = TypeObjectUtils::build_complete_struct_member(common_altitude, detail_altitude);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_altitude);
+        }
+        {
+            TypeIdentifierPair type_ids_speed;
+            ReturnCode_t return_code_speed {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_speed =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_float", type_ids_speed);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_speed)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "speed Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_speed = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_speed = 0x00000006;
+            bool common_speed_ec {false};
+            CommonStructMember common_speed {TypeObjectUtils::build_common_struct_member(member_id_speed, member_flags_speed, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_speed, common_speed_ec))};
+            if (!common_speed_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure speed member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_speed = "speed";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_speed;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_speed = TypeObjectUtils::build_complete_member_detail(name_speed, member_ann_builtin_speed, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_speed = TypeObjectUtils::build_complete_struct_member(common_speed, detail_speed);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_speed);
+        }
+        {
+            TypeIdentifierPair type_ids_status;
+            ReturnCode_t return_code_status {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_status =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "FlightStatus", type_ids_status);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_status)
+            {
+            ::register_FlightStatus_type_identifier(type_ids_status);
+            }
+            StructMemberFlag member_flags_status = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_status = 0x00000007;
+            bool common_status_ec {false};
+            CommonStructMember common_status {TypeObjectUtils::build_common_struct_member(member_id_status, member_flags_status, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_status, common_status_ec))};
+            if (!common_status_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure status member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_status = "status";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_status;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_status = TypeObjectUtils::build_complete_member_detail(name_status, member_ann_builtin_status, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_status = TypeObjectUtils::build_complete_struct_member(common_status, detail_status);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_status);
+        }
+        {
+            TypeIdentifierPair type_ids_latency_us;
+            ReturnCode_t return_code_latency_us {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_latency_us =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "_uint16_t", type_ids_latency_us);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_latency_us)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                        "latency_us Structure member TypeIdentifier unknown to TypeObjectRegistry.");
+                return;
+            }
+            StructMemberFlag member_flags_latency_us = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_latency_us = 0x00000008;
+            bool common_latency_us_ec {false};
+            CommonStructMember common_latency_us {TypeObjectUtils::build_common_struct_member(member_id_latency_us, member_flags_latency_us, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_latency_us, common_latency_us_ec))};
+            if (!common_latency_us_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure latency_us member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_latency_us = "latency_us";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_latency_us;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_latency_us = TypeObjectUtils::build_complete_member_detail(name_latency_us, member_ann_builtin_latency_us, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_latency_us = TypeObjectUtils::build_complete_struct_member(common_latency_us, detail_latency_us);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_latency_us);
+        }
+        {
+            TypeIdentifierPair type_ids_flags;
+            ReturnCode_t return_code_flags {eprosima::fastdds::dds::RETCODE_OK};
+            return_code_flags =
+                eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+                "TelemetryFlags", type_ids_flags);
+
+            if (eprosima::fastdds::dds::RETCODE_OK != return_code_flags)
+            {
+            ::register_TelemetryFlags_type_identifier(type_ids_flags);
+            }
+            StructMemberFlag member_flags_flags = TypeObjectUtils::build_struct_member_flag(eprosima::fastdds::dds::xtypes::TryConstructFailAction::DISCARD,
+                    false, false, false, false);
+            MemberId member_id_flags = 0x00000009;
+            bool common_flags_ec {false};
+            CommonStructMember common_flags {TypeObjectUtils::build_common_struct_member(member_id_flags, member_flags_flags, TypeObjectUtils::retrieve_complete_type_identifier(type_ids_flags, common_flags_ec))};
+            if (!common_flags_ec)
+            {
+                EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION, "Structure flags member TypeIdentifier inconsistent.");
+                return;
+            }
+            MemberName name_flags = "flags";
+            eprosima::fastcdr::optional<AppliedBuiltinMemberAnnotations> member_ann_builtin_flags;
+            ann_custom_AircraftTelemetry.reset();
+            CompleteMemberDetail detail_flags = TypeObjectUtils::build_complete_member_detail(name_flags, member_ann_builtin_flags, ann_custom_AircraftTelemetry);
+            CompleteStructMember member_flags = TypeObjectUtils::build_complete_struct_member(common_flags, detail_flags);
+            TypeObjectUtils::add_complete_struct_member(member_seq_AircraftTelemetry, member_flags);
+        }
+        CompleteStructType struct_type_AircraftTelemetry = TypeObjectUtils::build_complete_struct_type(struct_flags_AircraftTelemetry, header_AircraftTelemetry, member_seq_AircraftTelemetry);
+        if (eprosima::fastdds::dds::RETCODE_BAD_PARAMETER ==
+                TypeObjectUtils::build_and_register_struct_type_object(struct_type_AircraftTelemetry, type_name_AircraftTelemetry.to_string(), type_ids_AircraftTelemetry))
+        {
+            EPROSIMA_LOG_ERROR(XTYPES_TYPE_REPRESENTATION,
+                    "AircraftTelemetry already registered in TypeObjectRegistry for a different type.");
+        }
+    }
+}
@@ -0,0 +1,122 @@
+//versioni della telemetria: v1 (SystemStats, stato come stringa) e v2 (SystemStatsV2, stato come codice
+//enum e flag a bit, 31 byte serializzati). Chi pubblica in AUTO scrive solo le versioni che hanno lettori,
+//MonitorApp in AUTO prova prima la v2 e torna alla v1 se nessuno la pubblica.
+//fleet è la v2 con chiave (AircraftTelemetry): ogni aereo, scelto con FBW_AIRCRAFT_ID, è un'istanza a sé
+//di TelemetryFleetTopic e un solo monitor li segue tutti. Non fa parte di AUTO, va chiesta esplicitamente
+#ifndef TELEMETRY_VERSION_HPP
+#define TELEMETRY_VERSION_HPP
+
+#include "TelemetryPubSubTypes.hpp"
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+enum class TelemetryVersion { V1, V2, FLEET, AUTO };
+
+constexpr const char* TELEMETRY_V2_TOPIC = "TelemetryV2Topic";
+constexpr const char* TELEMETRY_FLEET_TOPIC = "TelemetryFleetTopic";
+
+constexpr const char* AIRCRAFT_ID_ENV = "FBW_AIRCRAFT_ID";
+
+// istanze che un lettore della flotta accetta (resource limits del reader)
+constexpr int FLEET_MAX_AIRCRAFT = 10000;
+
+// id di un aereo scritto in decimale, da 0 a 4294967295; false per testo vuoto, segni, altri caratteri o fuori scala
+// (strtoul da solo accetta "-1" e lo fa diventare 4294967295)
+inline bool parse_aircraft_id(const char* s, uint32_t& out) {
+    if (s == nullptr || *s < '0' || *s > '9') return false;
+    errno = 0;
+    char* end = nullptr;
+    unsigned long long v = std::strtoull(s, &end, 10);
+    if (errno != 0 || *end != '\0' || v > 0xFFFFFFFFull) return false;
+    out = (uint32_t) v;
+    return true;
+}
+
+// FBW_AIRCRAFT_ID in id se c'è (altrimenti id resta com'è), false se c'è ma non è un id valido
+inline bool aircraft_id_from_env(uint32_t& id) {
+    const char* env = std::getenv(AIRCRAFT_ID_ENV);
+    return env == nullptr || parse_aircraft_id(env, id);
+}
+
+inline bool parse_telemetry_version(const std::string& s, TelemetryVersion& out) {
+    if (s == "v1") out = TelemetryVersion::V1;
+    else if (s == "v2") out = TelemetryVersion::V2;
+    else if (s == "fleet") out = TelemetryVersion::FLEET;
+    else if (s == "auto") out = TelemetryVersion::AUTO;
+    else return false;
+    return true;
+}
+
+inline const char* telemetry_version_name(TelemetryVersion v) {
+    switch (v) {
+        case TelemetryVersion::V1: return "v1";
+        case TelemetryVersion::V2: return "v2";
+        case TelemetryVersion::FLEET: return "fleet";
+        default: return "auto";
+    }
+}
+
+// Testo del codice, lo stesso che la v1 mette in status_msg
+inline const char* status_text(FlightStatus status) {
+    switch (status) {
+        case FlightStatus::AUTOPILOT_RECOVERY: return "AUTOPILOT: RECOVERY";
+        case FlightStatus::WARN_HIGH_BANK: return "WARN: HIGH BANK ANGLE";
+        case FlightStatus::ALARM_TERRAIN_PULL_UP: return "ALARM: TERRAIN PULL UP";
+        case FlightStatus::ALARM_HIGH_ALTITUDE: return "ALARM: HIGH ALTITUDE";
+        default: return "NOMINAL FLIGHT";
+    }
+}
+
+// Solo per i campioni v1: il testo torna codice una volta sola, quando arriva
+inline FlightStatus status_from_text(const char* msg) {
+    for (FlightStatus s : { FlightStatus::AUTOPILOT_RECOVERY, FlightStatus::WARN_HIGH_BANK,
+                            FlightStatus::ALARM_TERRAIN_PULL_UP, FlightStatus::ALARM_HIGH_ALTITUDE }) {
+        if (std::strcmp(msg, status_text(s)) == 0) return s;
+    }
+    return FlightStatus::NOMINAL_FLIGHT;
+}
+
+inline bool is_alarm(FlightStatus status) {
+    return status == FlightStatus::ALARM_TERRAIN_PULL_UP || status == FlightStatus::ALARM_HIGH_ALTITUDE;
+}
+
+inline bool is_warning(FlightStatus status) {
+    return status == FlightStatus::WARN_HIGH_BANK;
+}
+
+// latency_us della v1 è un float, nella v2 sta in 16 bit: oltre 65535 us resta 65535 invece di ricominciare da 0
+inline uint16_t latency_us_v2(float latency_us) {
+    if (!(latency_us > 0.0f)) return 0;
+    return latency_us >= (float) UINT16_MAX ? UINT16_MAX : (uint16_t) latency_us;
+}
+
+// Il monitor lavora sempre su SystemStatsV2, i campioni v1 si convertono all'arrivo
+inline void to_v2(const SystemStats& in, SystemStatsV2& out) {
+    out.packet_id(in.packet_id());
+    out.roll(in.roll());
+    out.pitch(in.pitch());
+    out.yaw(in.yaw());
+    out.altitude(in.altitude());
+    out.speed(in.speed());
+    out.status(status_from_text(in.status_msg().c_str()));
+    out.latency_us(latency_us_v2(in.latency_us()));
+    out.flags(in.deadline_missed() ? FLAG_DEADLINE_MISSED : 0);
+}
+
+// Il campione di flotta è la v2 più la chiave
+inline void to_v2(const AircraftTelemetry& in, SystemStatsV2& out) {
+    out.packet_id(in.packet_id());
+    out.roll(in.roll());
+    out.pitch(in.pitch());
+    out.yaw(in.yaw());
+    out.altitude(in.altitude());
+    out.speed(in.speed());
+    out.status(in.status());
+    out.latency_us(in.latency_us());
+    out.flags(in.flags());
+}
+
+#endif
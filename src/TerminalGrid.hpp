@@ -0,0 +1,142 @@
+//disegno a griglia di celle per le dashboard nel terminale: si scrive il frame in un buffer (carattere e stile per
+//cella) e flush() manda solo le celle cambiate rispetto al frame precedente, con gli spostamenti del cursore e i
+//cambi di colore strettamente necessari, in una sola write(). Un frame uguale al precedente non scrive niente.
+//Il buffer di uscita si alloca alla prima flush e poi si riusa
+#ifndef TERMINAL_GRID_HPP
+#define TERMINAL_GRID_HPP
+
+#include <cerrno>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+// colori ANSI usati dalle dashboard (grassetto), i BANNER sono colori di sfondo
+enum CellStyle : uint8_t {
+    STYLE_NORMAL,
+    STYLE_RED,
+    STYLE_YELLOW,
+    STYLE_GREEN,
+    STYLE_CYAN,
+    STYLE_MAGENTA,
+    STYLE_BANNER_RED,
+    STYLE_BANNER_YELLOW,
+    STYLE_BANNER_BLUE
+};
+
+inline const char* cell_style_sgr(CellStyle style) {
+    static const char* const SGR[] = { "\033[0m", "\033[0;1;31m", "\033[0;1;33m", "\033[0;1;32m", "\033[0;1;36m",
+                                       "\033[0;1;35m", "\033[0;1;41m", "\033[0;1;43m", "\033[0;1;44m" };
+    return SGR[style];
+}
+
+class TerminalGrid {
+    struct Cell {
+        char ch;
+        CellStyle style;
+        bool operator==(const Cell& other) const { return ch == other.ch && style == other.style; }
+    };
+
+    int cols;
+    int rows;
+    std::vector<Cell> back;  // frame in costruzione
+    std::vector<Cell> front; // quello che c'è a schermo
+    std::string out;
+    bool full = true;        // il prossimo frame pulisce lo schermo e ridisegna tutto
+
+    void move_to(int row, int col) {
+        char seq[24];
+        int n = std::snprintf(seq, sizeof(seq), "\033[%d;%dH", row + 1, col + 1);
+        out.append(seq, n);
+    }
+
+public:
+    long frames = 0;         // frame che hanno scritto qualcosa
+    long bytes_written = 0;
+
+    TerminalGrid(int c, int r) : cols(c), rows(r), back(c * r, Cell{ ' ', STYLE_NORMAL }), front(back) {}
+
+    int width() const { return cols; }
+    int height() const { return rows; }
+
+    // frame vuoto: si ridisegna da capo a ogni frame, il confronto con quello a schermo lo fa flush()
+    void clear() {
+        for (Cell& cell : back) cell = Cell{ ' ', STYLE_NORMAL };
+    }
+
+    // il prossimo frame si manda tutto (all'avvio o se qualcun altro ha scritto sul terminale)
+    void invalidate() { full = true; }
+
+    // testo dalla colonna col della riga row (da 0), tagliato al bordo; restituisce la colonna dopo il testo
+    int text(int row, int col, CellStyle style, const char* s) {
+        if (row < 0 || row >= rows) return col;
+        for (; *s != '\0' && col < cols; s++, col++) {
+            if (col >= 0) back[row * cols + col] = Cell{ *s, style };
+        }
+        return col;
+    }
+
+    int format(int row, int col, CellStyle style, const char* fmt, ...) __attribute__((format(printf, 5, 6))) {
+        char buf[256];
+        va_list args;
+        va_start(args, fmt);
+        std::vsnprintf(buf, sizeof(buf), fmt, args);
+        va_end(args);
+        return text(row, col, style, buf);
+    }
+
+    // barra [|||||     ] di width celle riempita in proporzione a value / max
+    int bar(int row, int col, float value, float max, int width, CellStyle style) {
+        int fill = (int) ((value / max) * width);
+        if (fill > width) fill = width;
+        if (fill < 0) fill = 0;
+        col = text(row, col, STYLE_NORMAL, "[");
+        for (int i = 0; i < width; i++) col = text(row, col, i < fill ? style : STYLE_NORMAL, i < fill ? "|" : " ");
+        return text(row, col, STYLE_NORMAL, "]");
+    }
+
+    // manda a fd le differenze dal frame precedente, restituisce i byte scritti (0 se non è cambiato niente)
+    size_t flush(int fd) {
+        out.clear();
+        if (full) out += "\033[0m\033[2J";
+        int cursor_row = -1, cursor_col = -1;
+        int style = -1;
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                const Cell& cell = back[r * cols + c];
+                if (full ? cell.ch == ' ' && cell.style == STYLE_NORMAL : cell == front[r * cols + c]) continue;
+                if (r != cursor_row || c != cursor_col) move_to(r, c);
+                if (cell.style != style) {
+                    out += cell_style_sgr(cell.style);
+                    style = cell.style;
+                }
+                out += cell.ch;
+                cursor_row = r;
+                cursor_col = c + 1;
+            }
+        }
+        full = false;
+        front = back;
+        if (out.empty()) return 0;
+
+        // cursore sotto la griglia e colori normali, per chi scrive sul terminale dopo
+        out += "\033[0m";
+        move_to(rows, 0);
+        size_t done = 0;
+        while (done < out.size()) {
+            ssize_t n = ::write(fd, out.data() + done, out.size() - done);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                break;
+            }
+            done += (size_t) n;
+        }
+        frames++;
+        bytes_written += (long) done;
+        return done;
+    }
+};
+
+#endif
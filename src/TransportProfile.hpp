@@ -0,0 +1,99 @@
+//profili di trasporto DDS, uguali per tutti gli eseguibili (FlightSim, FlightComputer, MonitorApp e rt_tests):
+//- default: quello che sceglie Fast DDS (UDPv4 + memoria condivisa, discovery multicast, intraprocesso se possibile)
+//- shm:     solo memoria condivisa, anche la discovery. Funziona solo fra processi della stessa macchina
+//- udp:     solo UDPv4 sull'interfaccia di loopback, discovery unicast verso 127.0.0.1, niente memoria condivisa
+//- intra:   consegna intraprocesso per tutto (anche la discovery) e memoria condivisa per gli altri processi
+//Il profilo si sceglie con FBW_TRANSPORT=default|shm|udp|intra, FlightSim accetta anche --transport
+#ifndef TRANSPORT_PROFILE_HPP
+#define TRANSPORT_PROFILE_HPP
+
+#include <fastdds/LibrarySettings.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/rtps/common/Locator.hpp>
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.hpp>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.hpp>
+#include <fastdds/utils/IPLocator.hpp>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+enum class TransportProfile { DEFAULT, SHM, UDP, INTRA };
+
+constexpr const char* TRANSPORT_PROFILE_ENV = "FBW_TRANSPORT";
+
+inline bool parse_transport_profile(const std::string& s, TransportProfile& out) {
+    if (s == "default") out = TransportProfile::DEFAULT;
+    else if (s == "shm") out = TransportProfile::SHM;
+    else if (s == "udp") out = TransportProfile::UDP;
+    else if (s == "intra") out = TransportProfile::INTRA;
+    else return false;
+    return true;
+}
+
+inline const char* transport_profile_name(TransportProfile p) {
+    switch (p) {
+        case TransportProfile::SHM: return "shm";
+        case TransportProfile::UDP: return "udp";
+        case TransportProfile::INTRA: return "intra";
+        default: return "default";
+    }
+}
+
+// FBW_TRANSPORT se c'è ed è valida, altrimenti fallback
+inline TransportProfile transport_profile_from_env(TransportProfile fallback = TransportProfile::DEFAULT) {
+    const char* env = std::getenv(TRANSPORT_PROFILE_ENV);
+    TransportProfile p = fallback;
+    if (env != nullptr) parse_transport_profile(env, p);
+    return p;
+}
+
+// La consegna intraprocesso è un'impostazione della libreria, non del participant: va scelta prima di crearne
+// uno (o quando non ce n'è più nessuno). shm e udp la spengono, altrimenti due participant dello stesso
+// processo non passerebbero mai dal trasporto che si vuole provare
+inline bool select_transport_library(TransportProfile p) {
+    if (p == TransportProfile::DEFAULT) return true;
+    eprosima::fastdds::LibrarySettings settings;
+    settings.intraprocess_delivery = p == TransportProfile::INTRA ? eprosima::fastdds::INTRAPROCESS_FULL
+                                                                  : eprosima::fastdds::INTRAPROCESS_OFF;
+    return eprosima::fastdds::dds::DomainParticipantFactory::get_instance()->set_library_settings(settings)
+           == eprosima::fastdds::dds::RETCODE_OK;
+}
+
+// Trasporti del participant secondo il profilo, default lascia la QoS com'è
+inline void apply_transport_profile(eprosima::fastdds::dds::DomainParticipantQos& pqos, TransportProfile p) {
+    using namespace eprosima::fastdds::rtps;
+    if (p == TransportProfile::DEFAULT) return;
+
+    pqos.transport().use_builtin_transports = false;
+    pqos.transport().user_transports.clear();
+    if (p == TransportProfile::UDP) {
+        auto udp = std::make_shared<UDPv4TransportDescriptor>();
+        udp->interface_allowlist.emplace_back("127.0.0.1");
+        pqos.transport().user_transports.push_back(udp);
+
+        // lo spesso non fa multicast: la discovery va in unicast verso la macchina stessa
+        Locator_t peer;
+        peer.kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(peer, 127, 0, 0, 1);
+        pqos.wire_protocol().builtin.initialPeersList.push_back(peer);
+    }
+    else {
+        // shm e intra: con intra la memoria condivisa serve solo ai participant di altri processi
+        pqos.transport().user_transports.push_back(std::make_shared<SharedMemTransportDescriptor>());
+    }
+}
+
+// Il data-sharing passa dalla memoria condivisa anche senza il trasporto SHM: con udp va spento, altrimenti
+// i campioni prestati non toccherebbero mai la rete
+inline bool transport_allows_data_sharing(TransportProfile p) {
+    return p != TransportProfile::UDP;
+}
+
+// Le due cose insieme, per chi crea i participant una volta sola all'avvio
+inline void setup_transport(eprosima::fastdds::dds::DomainParticipantQos& pqos, TransportProfile p) {
+    select_transport_library(p);
+    apply_transport_profile(pqos, p);
+}
+
+#endif
@@ -0,0 +1,103 @@
+//lettura dei DataReader con un WaitSet invece che con il listener: un thread nostro, con core e priorità scelti
+//(anche SCHED_FIFO), dorme sul WaitSet finché uno dei reader ha dati e poi li prende a gruppi con take() in
+//prestito, fino a max_batch campioni per chiamata. Niente callback nei thread di Fast DDS e una sola sveglia per
+//tutti i campioni arrivati insieme. I reader vanno creati senza listener (o con StatusMask::none())
+#ifndef WAITSET_READER_HPP
+#define WAITSET_READER_HPP
+
+#include "RtThread.hpp"
+#include <fastdds/dds/core/LoanableSequence.hpp>
+#include <fastdds/dds/core/condition/GuardCondition.hpp>
+#include <fastdds/dds/core/condition/StatusCondition.hpp>
+#include <fastdds/dds/core/condition/WaitSet.hpp>
+#include <fastdds/dds/core/status/StatusMask.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+constexpr int32_t READER_DEFAULT_BATCH = 32; // campioni per take() se non si sceglie altro
+
+// take() in prestito a gruppi di max_batch finché il reader non è vuoto: f(campione, info, ultimo del gruppo)
+// per ogni campione, anche quelli senza dati (istanze sparite). Restituisce quanti campioni ha preso
+template <typename T, typename F>
+inline size_t take_batch(eprosima::fastdds::dds::DataReader* reader, int32_t max_batch, F&& f) {
+    using namespace eprosima::fastdds::dds;
+    LoanableSequence<T> data;
+    SampleInfoSeq infos;
+    size_t total = 0;
+    while (reader->take(data, infos, max_batch) == RETCODE_OK) {
+        int32_t n = data.length();
+        for (int32_t i = 0; i < n; i++) f(data[i], infos[i], i + 1 == n);
+        total += (size_t) n;
+        reader->return_loan(data, infos);
+    }
+    return total;
+}
+
+class WaitSetReader {
+public:
+    // prende quello che c'è nel reader, di solito con take_batch
+    using Drain = std::function<void(eprosima::fastdds::dds::DataReader*)>;
+
+private:
+    struct Entry {
+        eprosima::fastdds::dds::DataReader* reader;
+        Drain drain;
+    };
+
+    eprosima::fastdds::dds::WaitSet waitset;
+    eprosima::fastdds::dds::GuardCondition stop_condition; // sveglia il thread per farlo uscire
+    std::vector<Entry> entries;
+    std::atomic<bool> stop{false};
+    std::thread worker;
+    long wakeups = 0; // solo il thread, si legge dopo shutdown()
+
+    void run(int core, int priority) {
+        using namespace eprosima::fastdds::dds;
+        pin_current_thread(core, priority);
+        ConditionSeq active;
+        while (!stop.load()) {
+            if (waitset.wait(active, c_TimeInfinite) != RETCODE_OK) continue;
+            wakeups++;
+            for (Entry& e : entries) {
+                if (e.reader->get_statuscondition().get_trigger_value()) e.drain(e.reader);
+            }
+        }
+    }
+
+public:
+    // prima di start(): il reader sveglia il thread quando ha dati (DATA_AVAILABLE)
+    void attach(eprosima::fastdds::dds::DataReader* reader, Drain drain) {
+        using namespace eprosima::fastdds::dds;
+        reader->get_statuscondition().set_enabled_statuses(StatusMask::data_available());
+        waitset.attach_condition(reader->get_statuscondition());
+        entries.push_back({ reader, drain });
+    }
+
+    // core < 0 e priority <= 0 come pin_current_thread
+    void start(int core, int priority) {
+        waitset.attach_condition(stop_condition);
+        worker = std::thread(&WaitSetReader::run, this, core, priority);
+    }
+
+    // va chiamata prima di cancellare i reader
+    void shutdown() {
+        if (!worker.joinable()) return;
+        stop.store(true);
+        stop_condition.set_trigger_value(true);
+        worker.join();
+        for (Entry& e : entries) waitset.detach_condition(e.reader->get_statuscondition());
+        waitset.detach_condition(stop_condition);
+    }
+
+    ~WaitSetReader() { shutdown(); }
+
+    long wakeup_count() const { return wakeups; }
+};
+
+#endif
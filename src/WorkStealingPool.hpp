@@ -0,0 +1,93 @@
+//thread pool con work stealing: ogni worker ha la sua coda, prende dal fondo la propria
+//e quando è vuota ruba dalla testa di quella di un altro, così i lavori lunghi non lasciano core fermi
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include "RtThread.hpp"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    // il lavoro riceve l'indice del worker che lo esegue, per scrivere nei suoi risultati senza lock
+    using Job = std::function<void(unsigned worker)>;
+
+private:
+    struct alignas(64) Worker {
+        std::mutex mtx;
+        std::deque<Job> jobs;
+        long executed = 0;
+        long stolen = 0;
+    };
+
+    std::vector<Worker> workers;
+    std::atomic<long> pending{0};
+    unsigned next_worker = 0;
+
+    bool pop_local(unsigned id, Job& job) {
+        Worker& w = workers[id];
+        std::lock_guard<std::mutex> lock(w.mtx);
+        if (w.jobs.empty()) return false;
+        job = std::move(w.jobs.back());
+        w.jobs.pop_back();
+        return true;
+    }
+
+    bool steal(unsigned id, Job& job) {
+        for (size_t i = 1; i < workers.size(); i++) {
+            Worker& victim = workers[(id + i) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mtx);
+            if (victim.jobs.empty()) continue;
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void worker_loop(unsigned id, bool pin) {
+        if (pin && id < std::thread::hardware_concurrency()) pin_current_thread((int) id, 0);
+        Job job;
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (pop_local(id, job)) {
+            } else if (steal(id, job)) {
+                workers[id].stolen++;
+            } else {
+                std::this_thread::yield(); // gli ultimi lavori stanno girando sugli altri worker
+                continue;
+            }
+            job(id);
+            workers[id].executed++;
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+public:
+    explicit WorkStealingPool(unsigned n_workers) : workers(n_workers > 0 ? n_workers : 1) {}
+
+    unsigned size() const { return (unsigned) workers.size(); }
+
+    // da chiamare prima di run(): i lavori si distribuiscono a giro sulle code dei worker
+    void submit(Job job) {
+        Worker& w = workers[next_worker++ % workers.size()];
+        std::lock_guard<std::mutex> lock(w.mtx);
+        w.jobs.push_back(std::move(job));
+        pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // esegue tutto quello che è in coda e torna quando è finito; pin = un worker per core (0..n-1)
+    void run(bool pin = true) {
+        std::vector<std::thread> threads;
+        for (unsigned i = 0; i < workers.size(); i++) threads.emplace_back(&WorkStealingPool::worker_loop, this, i, pin);
+        for (auto& t : threads) t.join();
+    }
+
+    long executed(unsigned worker) const { return workers[worker].executed; }
+    long stolen(unsigned worker) const { return workers[worker].stolen; }
+};
+
+#endif
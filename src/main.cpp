@@ -1,269 +1,536 @@
 #include "SharedMemory.hpp"
-#include "TelemetryPubSubTypes.hpp"
-#include <fastdds/dds/domain/DomainParticipant.hpp>
-#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
-#include <fastdds/dds/publisher/Publisher.hpp>
-#include <fastdds/dds/publisher/DataWriter.hpp>
-#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
-#include <fastdds/dds/topic/Topic.hpp>
-#include <fastdds/dds/topic/TypeSupport.hpp>
-#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
-#include <fastdds/statistics/dds/domain/DomainParticipant.hpp>
-#include <fastdds/statistics/topic_names.hpp>
-#include <fastdds/statistics/dds/publisher/qos/DataWriterQos.hpp>
+#include "ProcessSharedBus.hpp"
+#include "FlightComputer.hpp"
+#include "AsyncPublish.hpp"
+#include "RtThread.hpp"
 #include <thread>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <vector>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <time.h>
+#include <sys/mman.h>
 #include "raylib.h"
 #include "raymath.h"
 #include "FlightDisplay.hpp"
+#include "FlightPhysics.hpp"
+#include "PilotScript.hpp"
+#include "InputLog.hpp"
 
 using namespace eprosima::fastdds::dds;
 //metto in numeri in questa scrittura 0f per trattarli come float
 
-//metto bus per usare la sharedMemoryBus.hpp
-SharedMemoryBus bus;
+//metto bus per usare la sharedMemoryBus.hpp, il tipo si sceglie da cmake con -DFLIGHT_BUS=
+//e il protocollo del mutex (solo MUTEX e POSIX_SHM) con -DFLIGHT_BUS_LOCK=
+#ifndef FLIGHT_BUS_LOCK_POLICY
+#define FLIGHT_BUS_LOCK_POLICY BusLockPolicy::DEFAULT
+#endif
+#if defined(FLIGHT_BUS_SEQLOCK)
+SeqLockBus bus;
+#elif defined(FLIGHT_BUS_RING)
+SpscRingBus<1024> bus;
+#elif defined(FLIGHT_BUS_POSIX_SHM)
+ProcessSharedBus bus(FBW_SHM_NAME, true, FLIGHT_BUS_LOCK_POLICY); // il lettore è l'eseguibile FlightComputer
+#elif defined(FLIGHT_BUS_BROADCAST)
+BroadcastBus<1024> bus; // computer di volo, flight recorder e health monitor vedono tutti ogni frame
+#else
+SharedMemoryBus bus(FLIGHT_BUS_LOCK_POLICY);
+#endif
 
 // Variabili Globali
-PlaneData Aereo;       // Stato attuale dell'aereo messo nel FlightDispaly.hpp
-std::mutex Aereo_mutex;      // Semaforo per thread safety
-
-
-void flight_computer_task(DataWriter* writer) {
-    FlightControls state;
-    SystemStats stats;
-    int count = 0;
-
-    std::cout << "[DDS] Computer di bordo avviato. In attesa dati..." << std::endl;
-
-    while(true) {
-        // Controllo se dobbiamo chiudere
-    	bool active;
-        {
-            std::lock_guard<std::mutex> lock(Aereo_mutex);
-            active = Aereo.system_active;
-        }
-        if (!active) break;
+// la fisica e il fly-by-wire girano nel loro thread a frequenza fissa, il render legge solo le fotografie
+struct PhysicsConfig {
+    int rate_hz = 500;
+    int core = -1;          // core isolato per la fisica, -1 = nessuna affinità
+    int priority = 0;       // > 0 SCHED_FIFO
+    bool deadline = false;  // SCHED_DEADLINE con runtime = metà periodo
+};
+
+// due passi consecutivi della fisica, il render disegna una posizione intermedia
+struct PhysicsSnapshot {
+    PlaneData prev;
+    PlaneData curr;
+    long t_curr_ns = 0; // attivazione programmata del passo che ha prodotto curr (CLOCK_MONOTONIC)
+};
+
+SeqLock<PilotInput> pilot_input;           // render -> fisica, ultimo stato della tastiera
+SeqLock<PhysicsSnapshot> physics_snapshot; // fisica -> render
+constexpr int SNAPSHOT_LOAD_ATTEMPTS = 8;  // poi il render ridisegna la fotografia del frame prima
+std::atomic<bool> physics_running{true};
+PeriodicStats physics_stats;               // la scrive solo il thread della fisica, si legge dopo il join
+std::unique_ptr<InputRecorder> input_recorder;   // solo con --record
+BusLatencyStats fc_response;               // frame scritto dalla fisica -> publish (o push) finito, solo il computer di volo
+
+long monotonic_ns() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000L + t.tv_nsec;
+}
 
-        //e qua che faccio la lettura dopo la scrittura del pilota con un timeout di 100 milisecondi perui se pri,a non arriva nulla leggo
-        bool ok = bus.read_with_timeout(state, 100);
 
-        if(ok) {
-            // prendo dalla strucin telemtry idl che nel monitor node usero per la stampa
-            stats.packet_id(state.packet_id);
-            stats.roll(state.aileron);
-            stats.pitch(state.elevator);
-            stats.yaw(state.rudder);
-            stats.altitude(state.altitude);
-            stats.speed(state.speed);//aggiunto a posteriori ho dovuto aggiornare file con .idl
+// quanti frame il computer di volo prende dal bus in una volta sola
+constexpr size_t BUS_BATCH = 64;
 
-            // Logica autopilota
-            if (state.autopilot_engaged) {
-            	// Usiamo questo flag per indicare RECOVERY
-                if (state.altitude < 1000.0f) stats.status_msg("ALARM: TERRAIN PULL UP");
+// con --async-publish il computer di volo passa i frame al thread writer DDS attraverso questa coda
+using TelemetryStage = AsyncPublishStage<FlightControls, 1024>;
 
-                else if (state.altitude > 12000.0f) stats.status_msg("ALARM: HIGH ALTITUDE");
+// Reader è il bus stesso oppure, col bus broadcast, il cursore di questo lettore.
+// stage == nullptr: la write DDS si fa qui; altrimenti qui si fa solo il push e il batch lo gestisce il writer
+template <typename Reader>
+void flight_computer_task(TelemetryPublisher* telemetry, Reader& reader, TelemetryStage* stage, int core, int priority) {
+    FlightControls batch[BUS_BATCH];
 
-                else stats.status_msg("AUTOPILOT: RECOVERY");
-            }
-            else if (std::abs(state.aileron) > 1.2f) stats.status_msg("WARN: HIGH BANK ANGLE");
+    pin_current_thread(core, priority);
+    std::cout << "[DDS] Computer di bordo avviato" << (stage != nullptr ? " (pubblicazione asincrona)" : "")
+              << ". In attesa dati..." << std::endl;
 
-            else stats.status_msg("NOMINAL FLIGHT");
+    while(true) {
+        // niente più timeout: il thread dorme sul bus finché non arriva un frame o lo shutdown() di fine programma
+        //con la coda circolare prendo tutti i frame arrivati, con gli altri bus al massimo uno
+        //(con --batch il timeout è quello che resta della finestra del batch in attesa)
+        size_t n = reader.read_batch(batch, BUS_BATCH, stage != nullptr ? -1 : telemetry->flush_timeout_ms());
+        if (n == 0) {
+            // finestra scaduta: spedisco e torno a dormire; senza niente in attesa è lo shutdown
+            if (stage == nullptr && telemetry->flush()) continue;
+            break;
+        }
 
-            // scrivo all'interno della struct
-            writer->write(&stats);
-            count++;
-        } else {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        for (size_t i = 0; i < n; i++) {
+            // v1, v2 o tutte e due (--telemetry), con copia o con campione prestato (FLIGHT_TELEMETRY=LOAN)
+            if (stage != nullptr) stage->push(batch[i]);
+            else telemetry->publish(batch[i]);
+            fc_response.record(batch[i].timestamp);
         }
     }
 }
 
+#if defined(FLIGHT_BUS_BROADCAST)
+// Flight recorder: salva ogni frame FlightControls così com'è in un file binario
+void flight_recorder_task(BroadcastBus<1024>::Consumer& reader, const char* path) {
+    FILE* f = std::fopen(path, "wb");
+    if (f == nullptr) {
+        std::perror("flight recorder");
+        return;
+    }
+    FlightControls batch[BUS_BATCH];
+    size_t n;
+    while ((n = reader.read_batch(batch, BUS_BATCH, -1)) > 0) {
+        std::fwrite(batch, sizeof(FlightControls), n, f);
+    }
+    std::fclose(f);
+}
 
-int main() {
-
-	DomainParticipantQos pqos;
-	    pqos.name("Pilot_Node_F35");
-//messo per poter usare le statistiche
-	    pqos.properties().properties().emplace_back("fastdds.statistics",
-	        "HISTORY_LATENCY;"
-	        "NETWORK_LATENCY;"
-	        "PUBLICATION_THROUGHPUT;"
-	        "SUBSCRIPTION_THROUGHPUT;"
-	        "HEARTBEAT_COUNT;"
-	        "ACKNACK_COUNT;"
-	        "PHYSICAL_DATA_STATISTICS");
-	    DomainParticipant* participant = DomainParticipantFactory::get_instance()->create_participant(0, pqos);
-	    if (participant == nullptr) return 1;
-
-	    // statistiche uso narrow per attivarle
-	    auto* stat_participant = eprosima::fastdds::statistics::dds::DomainParticipant::narrow(participant);
-
-	    if (stat_participant != nullptr) {
-	        // Traffico Publisher e Subscriber
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::PUBLICATION_THROUGHPUT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::SUBSCRIPTION_THROUGHPUT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-
-	        // Latenza della rete DDS
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::HISTORY_LATENCY_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::NETWORK_LATENCY_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-
-	        // Affidabilità della comunicazione fra datawriter e datareader
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::HEARTBEAT_COUNT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::ACKNACK_COUNT_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-
-	        // utilizzo della cpu
-	        stat_participant->enable_statistics_datawriter(eprosima::fastdds::statistics::PHYSICAL_DATA_TOPIC, eprosima::fastdds::statistics::dds::STATISTICS_DATAWRITER_QOS);
-
-
-	    }
-    TypeSupport type(new SystemStatsPubSubType());
-    type.register_type(participant);
-
-    Publisher* pub = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
-    Topic* topic = participant->create_topic("TelemetryTopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
-
-
-
-    //DATAWRITER
-    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;//data writer quality of service
-
-    //setto a reliable
-    wqos.reliability().kind = RELIABLE_RELIABILITY_QOS;
-    //cerco di stampare gli heartbeat ogni 100 ms
-    wqos.reliable_writer_qos().times.heartbeat_period.seconds = 0;
-    wqos.reliable_writer_qos().times.heartbeat_period.seconds =0.100; // 100ms
-
-     DataWriter* writer = pub->create_datawriter(topic, wqos);
-    if (writer == nullptr) return 1;//controllo che e stat creato correttamente
-
-
-    std::thread Pilota_dds(flight_computer_task, writer);
-
+// Health monitor locale: controlla che i packet_id arrivino tutti e in ordine e conta le recovery
+void health_monitor_task(BroadcastBus<1024>::Consumer& reader) {
+    FlightControls batch[BUS_BATCH];
+    long last_id = -1, gaps = 0, recovery_frames = 0;
+    size_t n;
+    while ((n = reader.read_batch(batch, BUS_BATCH, -1)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            if (last_id >= 0 && batch[i].packet_id != last_id + 1) gaps++;
+            last_id = batch[i].packet_id;
+            if (batch[i].autopilot_engaged || batch[i].recovery_bank) recovery_frames++;
+        }
+    }
+    std::cout << "[HEALTH] buchi nella sequenza: " << gaps << " | frame in recovery: " << recovery_frames << std::endl;
+}
+#endif
+
+
+PlaneData initial_plane() {
+    PlaneData Aereo{};
+    Aereo.roll = 0.0f;
+    Aereo.pitch = 0.0f;
+    Aereo.yaw = 0.0f;
+    Aereo.altitude = 4000.0f;
+    Aereo.x = 0.0f; // Partenza al centro della mappa
+    Aereo.z = 0.0f;
+    Aereo.speed=0.0f;
+    Aereo.system_active = true;
+    return Aereo;
+}
 
-        FlightDisplay display(1000, 800, "Leonardo Flight System - Manual Control");
+// Comandi e fly-by-wire di un passo, senza bus: il replay rifà il volo senza pubblicarlo
+void advance_step(PlaneData& Aereo, FbwState& fbw, const PilotInput& input, float dt_scale) {
+    apply_pilot_input(Aereo, input, dt_scale);
+    fbw_step(Aereo, fbw, dt_scale);
+}
 
-        unsigned long packet_id = 0;
+// Un passo della simulazione, uguale con la finestra e senza: comandi, fly-by-wire e frame sul bus
+void simulate_step(PlaneData& Aereo, FbwState& fbw, const PilotInput& input, float dt_scale, unsigned long& packet_id) {
+    advance_step(Aereo, fbw, input, dt_scale);
 
+    bus.write(packet_id++, Aereo.roll, Aereo.pitch, Aereo.yaw, Aereo.altitude, fbw.autopilot_engaged(),Aereo.speed,Aereo.x,Aereo.z,fbw.recovery_bank);
 
-        bool recovery_low = false;
-        bool recovery_high = false;
-        bool recovery_bank = false;
-        bool recovery_zero=false;
+    if (input_recorder) input_recorder->record(input, Aereo, fbw);
+}
 
-        Aereo.roll = 0.0f;
-        Aereo.pitch = 0.0f;
-        Aereo.yaw = 0.0f;
-        Aereo.altitude = 4000.0f;
-        Aereo.x = 0.0f; // Partenza al centro della mappa
-        Aereo.z = 0.0f;
-        Aereo.speed=0.0f;
-        Aereo.system_active = true;
+// Thread real-time: comandi del pilota, fly-by-wire, integrazione e scrittura sul bus a periodo fisso
+void physics_task(PhysicsConfig cfg) {
+    long period_ns = 1000000000L / cfg.rate_hz;
+    if (cfg.deadline) {
+        pin_current_thread(cfg.core, 0);
+        set_deadline_current_thread(period_ns / 2000, period_ns / 1000, period_ns / 1000);
+    } else {
+        pin_current_thread(cfg.core, cfg.priority);
+    }
 
+    float dt_scale = step_scale((float) cfg.rate_hz);
+    unsigned long packet_id = 0;
+    FbwState fbw;
+    PilotInput input;
+    uint64_t input_seq;
 
+    PlaneData Aereo = initial_plane();
 
-        while (display.IsActive()) {
+    PhysicsSnapshot snap{};
+    snap.prev = Aereo;
+    snap.curr = Aereo;
 
-                    // 1. LEGGE I COMANDI (Nessuna fisica qui, solo input utente)
-                    display.HandleInput(Aereo);
+    struct timespec next, start, end;
+    clock_gettime(CLOCK_MONOTONIC, &next);
 
+    while (physics_running.load(std::memory_order_relaxed)) {
+        timespec_add_ns(&next, period_ns);
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        clock_gettime(CLOCK_MONOTONIC, &start);
 
-                    // L'autopilota scatta solo se NON stai cercando di atterrare (Aereo.landing_mode == false)
-                    if (Aereo.altitude < 2000.0f && Aereo.speed >= 0.0f && !Aereo.landing_mode) {
-                        recovery_low = true;
-                    } else if (Aereo.landing_mode) {
-                        // Disattiva attivamente il recupero se attiviamo il Landing Mode mentre sta già correggendo
-                        recovery_low = false;
-                    }
-                    // Rischio caduta a motori spenti
-                    if (Aereo.speed < 10.0f && Aereo.altitude <= 2500.0f) recovery_zero = true;
+        // se il render sta scrivendo proprio ora tengo i comandi del passo prima
+        pilot_input.try_load(input, input_seq);
 
-                    // Rischio stratosfera / stallo (Sopra i 13000m)
-                    if (Aereo.altitude > 13000.0f) recovery_high = true;
+        snap.prev = Aereo;
+        simulate_step(Aereo, fbw, input, dt_scale, packet_id);
 
-                    // Inclinazione critica (Superiore a 1.2 radianti, come nell'HUD)
-                    if (std::abs(Aereo.roll) > 1.2f) recovery_bank = true;
+        snap.curr = Aereo;
+        snap.t_curr_ns = next.tv_sec * 1000000000L + next.tv_nsec;
+        physics_snapshot.store(snap);
 
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        physics_stats.record(timespec_diff_ns(start, end), timespec_diff_ns(next, start), period_ns);
+    }
+}
 
-                    if (recovery_low) {
-                        Aereo.roll *= 0.95f; // Raddrizza le ali
-                        if (Aereo.pitch < 0.3f) Aereo.pitch += 0.005f; // Tira su il muso dolcemente
-                        if (Aereo.speed < 150.0f) Aereo.speed += 0.5f; // Dà gas per salire
+// Modalità senza finestra: stessi passi della fisica con i comandi presi da uno script,
+// speedup = 0 va alla massima velocità della cpu, speedup = N va a N volte il tempo reale
+void run_headless(const PhysicsConfig& cfg, const PilotScript& script, double duration_s, double speedup) {
+    pin_current_thread(cfg.core, cfg.priority);
+
+    float dt_scale = step_scale((float) cfg.rate_hz);
+    long steps = (long) (duration_s * cfg.rate_hz);
+    long period_ns = speedup > 0.0 ? (long) (1000000000.0 / (cfg.rate_hz * speedup)) : 0;
+    unsigned long packet_id = 0;
+    FbwState fbw;
+    PlaneData Aereo = initial_plane();
+    float min_altitude = Aereo.altitude;
+    long recovery_steps = 0;
+
+    std::cout << "[HEADLESS] " << duration_s << " s simulati a " << cfg.rate_hz << " Hz ("
+              << steps << " passi), " << (speedup > 0.0 ? std::to_string(speedup) + "x tempo reale" : std::string("massima velocita'"))
+              << std::endl;
+
+    struct timespec next, start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    next = start;
+
+    for (long i = 0; i < steps; i++) {
+        if (period_ns > 0) {
+            timespec_add_ns(&next, period_ns);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        }
+        simulate_step(Aereo, fbw, script.at((double) i / cfg.rate_hz), dt_scale, packet_id);
 
-                        // Si spegne quando raggiungi quota di sicurezza (2500m)
-                        if (Aereo.altitude >= 2500.0f) recovery_low = false;
-                    }
+        if (Aereo.altitude < min_altitude) min_altitude = Aereo.altitude;
+        if (fbw.autopilot_engaged() || fbw.recovery_bank || fbw.recovery_zero) recovery_steps++;
+    }
 
-                    // Recupero a Motori Spenti (Riaccensione d'emergenza)
-                    if (recovery_zero) {
-                        if (Aereo.speed < 100.0f) Aereo.speed += 1.5f; // Booster ai motori
-                        if (Aereo.pitch < 0.2f) Aereo.pitch += 0.01f;  // Alza il muso per non cadere a picco
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall_s = timespec_diff_ns(start, end) / 1e9;
 
-                        if (Aereo.altitude >= 2500.0f && Aereo.speed >= 100.0f) recovery_zero = false;
-                    }
-                    // Recupero da Alta Quota (OVERSHOOT PULL DOWN)
-                    else if (recovery_high) {
-                        Aereo.roll *= 0.95f; // Raddrizza
-                        if (Aereo.pitch > 0.0f) Aereo.pitch -= 0.05f; // Abbassa il muso velocemente se punti in alto
-                        else if (Aereo.pitch > -0.2f) Aereo.pitch -= 0.005f; // Lo tiene inclinato verso il basso
+    std::cout << std::fixed << std::setprecision(2)
+              << "[HEADLESS] passi: " << steps << " in " << wall_s << " s | " << (steps / wall_s) << " passi/s | "
+              << (duration_s / wall_s) << "x tempo reale\n"
+              << "[HEADLESS] stato finale: quota " << Aereo.altitude << " m, x " << Aereo.x << ", z " << Aereo.z
+              << ", velocita' " << Aereo.speed << " | quota minima " << min_altitude << " m | passi in recovery: "
+              << recovery_steps << std::endl;
+}
 
-                        // Si spegne quando torni sotto i 12000m
-                        if (Aereo.altitude <= 12000.0f) recovery_high = false;
-                    }
+// Rifà un volo registrato con --record: stessi comandi e stessa frequenza della fisica, a ogni passo
+// confronta bit per bit lo stato con quello registrato. Niente sul bus: un MonitorApp in ascolto non deve
+// scambiare il replay per un volo vero
+bool run_replay(const PhysicsConfig& cfg, const InputLogHeader& header, const std::vector<InputLogRecord>& log, double speedup) {
+    pin_current_thread(cfg.core, cfg.priority);
+
+    int rate_hz = (int) header.rate_hz;
+    float dt_scale = step_scale((float) rate_hz);
+    long period_ns = speedup > 0.0 ? (long) (1000000000.0 / (rate_hz * speedup)) : 0;
+    FbwState fbw;
+    PlaneData Aereo = initial_plane();
+    long mismatches = 0, first_mismatch = -1;
+
+    std::cout << "[REPLAY] " << log.size() << " passi a " << rate_hz << " Hz ("
+              << (double) log.size() / rate_hz << " s simulati)" << std::endl;
+
+    struct timespec next, start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    next = start;
+
+    for (size_t i = 0; i < log.size(); i++) {
+        if (period_ns > 0) {
+            timespec_add_ns(&next, period_ns);
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+        }
+        PilotInput input = decode_input(log[i].input);
+        advance_step(Aereo, fbw, input, dt_scale);
+
+        InputLogRecord now = make_log_record(input, Aereo, fbw);
+        if (!same_record(now, log[i])) {
+            if (first_mismatch < 0) {
+                first_mismatch = (long) i;
+                std::cout << std::setprecision(9) << "[REPLAY] primo passo diverso: " << i
+                          << " | quota " << now.altitude << " invece di " << log[i].altitude
+                          << " | roll " << now.roll << " invece di " << log[i].roll
+                          << " | pitch " << now.pitch << " invece di " << log[i].pitch << std::endl;
+            }
+            mismatches++;
+        }
+    }
 
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double wall_s = timespec_diff_ns(start, end) / 1e9;
 
-                    if (recovery_bank) {
-                        // Raddrizza il rollio usando la funzione fluida
-                        if (Aereo.roll > 0.15f) Aereo.roll -= 0.015f;
-                        else if (Aereo.roll < -0.15f) Aereo.roll += 0.015f;
-                        else recovery_bank = false; // Disinnesca l'autopilota quando sei dritto
-                    }
+    std::cout << std::fixed << std::setprecision(2)
+              << "[REPLAY] passi: " << log.size() << " in " << wall_s << " s | " << (log.size() / wall_s) << " passi/s | "
+              << ((double) log.size() / rate_hz / wall_s) << "x tempo reale\n"
+              << "[REPLAY] " << (mismatches == 0 ? "IDENTICO bit per bit" : "DIVERSO") << " | passi diversi: " << mismatches
+              << std::endl;
+    return mismatches == 0;
+}
 
+int main(int argc, char* argv[]) {
+
+    // prima di ogni thread (anche quelli di Fast DDS): SIGUSR1 lo prende solo il thread di StatisticsSwitch
+    StatisticsSwitch::block_signal();
+
+    // USO: ./FlightSim [--rate hz] [--core n] [--prio p] [--deadline] [--render-core n]
+    //                  [--headless] [--script file] [--duration s] [--speedup N]
+    //                  [--record file] [--replay file] [--telemetry v1|v2|fleet|auto] [--batch n] [--batch-window ms]
+    //                  [--transport default|shm|udp|intra] [--stats off|basic|full] [--fc-core n] [--fc-prio p]
+    //                  [--async-publish] [--publish-core n] [--publish-prio p]
+    // --core/--prio/--deadline valgono per il thread della fisica, --render-core per il loop grafico
+    // --headless non apre la finestra: i comandi vengono da --script (o dalla manovra di default)
+    // --record salva comandi e uscite di ogni passo, --replay le rifà senza finestra e controlla che siano identiche
+    // --telemetry sceglie la versione pubblicata, auto (default) pubblica quelle che hanno almeno un lettore,
+    //   fleet pubblica la v2 con chiave come aereo FBW_AIRCRAFT_ID (default 1)
+    // --batch manda la v2 a pacchetti di n campioni (da 1 a 256), spediti prima se il più vecchio supera --batch-window
+    // --transport sceglie i trasporti DDS (TransportProfile.hpp), senza vale FBW_TRANSPORT
+    // --stats sceglie le statistiche Fast DDS (StatisticsLevel.hpp), senza vale FBW_STATISTICS (default off)
+    // --fc-core/--fc-prio valgono per il thread del computer di volo (quello che legge il bus)
+    // --async-publish sposta la write DDS in un thread writer (--publish-core/--publish-prio, sotto al computer di volo)
+    PhysicsConfig physics_cfg;
+    int render_core = -1;
+    bool headless = false;
+    std::string script_path;
+    double duration_s = 0.0; // 0 = lunghezza dello script
+    double speedup = 0.0;    // 0 = massima velocità
+    std::string record_path, replay_path;
+    TelemetryVersion telemetry_version = TelemetryVersion::AUTO;
+    int batch_samples = 1;
+    int batch_window_ms = TELEMETRY_BATCH_WINDOW_MS;
+    TransportProfile transport = transport_profile_from_env();
+    StatisticsLevel statistics = statistics_level_from_env();
+    int fc_core = -1, fc_priority = 0;
+    bool async_publish = false;
+    int publish_core = -1, publish_priority = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--rate" && has_value) physics_cfg.rate_hz = std::stoi(argv[++i]);
+        else if (arg == "--core" && has_value) physics_cfg.core = std::stoi(argv[++i]);
+        else if (arg == "--prio" && has_value) physics_cfg.priority = std::stoi(argv[++i]);
+        else if (arg == "--deadline") physics_cfg.deadline = true;
+        else if (arg == "--render-core" && has_value) render_core = std::stoi(argv[++i]);
+        else if (arg == "--headless") headless = true;
+        else if (arg == "--script" && has_value) script_path = argv[++i];
+        else if (arg == "--duration" && has_value) duration_s = std::stod(argv[++i]);
+        else if (arg == "--speedup" && has_value) speedup = std::stod(argv[++i]);
+        else if (arg == "--record" && has_value) record_path = argv[++i];
+        else if (arg == "--replay" && has_value) replay_path = argv[++i];
+        else if (arg == "--telemetry" && has_value) {
+            if (!parse_telemetry_version(argv[++i], telemetry_version)) {
+                std::cerr << "Versione telemetria sconosciuta: " << argv[i] << " (v1, v2, fleet o auto)" << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--batch" && has_value) batch_samples = std::stoi(argv[++i]);
+        else if (arg == "--batch-window" && has_value) batch_window_ms = std::stoi(argv[++i]);
+        else if (arg == "--transport" && has_value && parse_transport_profile(argv[i + 1], transport)) i++;
+        else if (arg == "--stats" && has_value && parse_statistics_level(argv[i + 1], statistics)) i++;
+        else if (arg == "--fc-core" && has_value) fc_core = std::stoi(argv[++i]);
+        else if (arg == "--fc-prio" && has_value) fc_priority = std::stoi(argv[++i]);
+        else if (arg == "--async-publish") async_publish = true;
+        else if (arg == "--publish-core" && has_value) publish_core = std::stoi(argv[++i]);
+        else if (arg == "--publish-prio" && has_value) publish_priority = std::stoi(argv[++i]);
+        else {
+            std::cerr << "Opzione sconosciuta: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (batch_samples < 1 || batch_samples > (int) TELEMETRY_BATCH_MAX) {
+        std::cerr << "--batch vuole da 1 a " << TELEMETRY_BATCH_MAX << " campioni, non " << batch_samples << std::endl;
+        return 1;
+    }
+    if (batch_window_ms < 0) {
+        std::cerr << "--batch-window non puo' essere negativa: " << batch_window_ms << std::endl;
+        return 1;
+    }
+    if (physics_cfg.rate_hz <= 0) physics_cfg.rate_hz = 500;
+    if (render_core >= 0) pin_current_thread(render_core, 0);
+    if (physics_cfg.priority > 0 || physics_cfg.deadline) mlockall(MCL_CURRENT | MCL_FUTURE);
+
+    InputLogHeader replay_header;
+    std::vector<InputLogRecord> replay_log;
+    if (!replay_path.empty()) {
+        if (!load_input_log(replay_path, replay_header, replay_log)) return 1;
+        headless = true;
+    }
+    if (!record_path.empty()) {
+        input_recorder.reset(new InputRecorder());
+        if (!input_recorder->open(record_path, physics_cfg.rate_hz, headless)) return 1;
+    }
 
-                    float speed_orizzontale = Aereo.speed * std::cos(Aereo.pitch);
-                    float speed_verticale   = Aereo.speed * std::sin(Aereo.pitch);
+    PilotScript script;
+    if (headless && replay_path.empty()) {
+        if (script_path.empty()) script.load_default();
+        else if (!script.load(script_path)) return 1;
+        if (duration_s <= 0.0) duration_s = script.length() > 0.0 ? script.length() : 60.0;
+    }
 
-                    // Perdita di portanza se l'aereo è troppo inclinato (Virata stretta)
-                    if (std::abs(Aereo.roll) > 0.8f) {
-                        speed_verticale -= 1.5f;
-                    }
+#if defined(FLIGHT_BUS_POSIX_SHM)
+    // in questa modalità il computer di volo e la parte DDS girano nel processo FlightComputer
+    // (versione, batch, trasporto e statistiche si passano a lui, gli ultimi due con FBW_TRANSPORT e FBW_STATISTICS)
+    (void) batch_samples;
+    (void) batch_window_ms;
+    (void) transport;
+    (void) statistics;
+    (void) fc_core;
+    (void) fc_priority;
+    (void) async_publish;
+    (void) publish_core;
+    (void) publish_priority;
+    if (!bus.is_open()) return 1;
+#else
+    TelemetryPublisher telemetry;
+    telemetry.set_transport(transport);
+    telemetry.set_statistics(statistics);
+    if (!telemetry.init("Pilot_Node_F35", telemetry_version, batch_samples, batch_window_ms)) return 1;//controllo che e stat creato correttamente
+    StatisticsSwitch statistics_switch; // kill -USR1 <pid>: statistiche full e ritorno, senza riavviare
+    statistics_switch.start(telemetry.dds_participant(), statistics);
+
+    std::unique_ptr<TelemetryStage> stage;
+    if (async_publish) {
+        // publish e flush del batch da qui in poi li chiama solo il thread writer
+        stage.reset(new TelemetryStage());
+        stage->start([&telemetry](const FlightControls& frame) { telemetry.publish(frame); },
+                     publish_core, publish_priority,
+                     [&telemetry]() { return telemetry.flush_timeout_ms(); },
+                     [&telemetry]() { telemetry.flush(); });
+    }
 
-                    // Effetto gravità se l'aereo va troppo piano
-                    if (Aereo.speed < 50.0f) {
-                        speed_verticale -= (50.0f - Aereo.speed) * 0.05f;
-                    }
+#if defined(FLIGHT_BUS_BROADCAST)
+    auto dds_reader = bus.subscribe("DDS");
+    auto recorder_reader = bus.subscribe("RECORDER");
+    auto health_reader = bus.subscribe("HEALTH");
+    std::thread Pilota_dds(flight_computer_task<BroadcastBus<1024>::Consumer>, &telemetry, std::ref(dds_reader),
+                           stage.get(), fc_core, fc_priority);
+    std::thread recorder(flight_recorder_task, std::ref(recorder_reader), "flight_recorder.bin");
+    std::thread health(health_monitor_task, std::ref(health_reader));
+#else
+    std::thread Pilota_dds(flight_computer_task<decltype(bus)>, &telemetry, std::ref(bus), stage.get(), fc_core, fc_priority);
+#endif
+#endif
+
+
+    bool replay_ok = true;
+    if (!replay_path.empty()) {
+        replay_ok = run_replay(physics_cfg, replay_header, replay_log, speedup);
+    } else if (headless) {
+        run_headless(physics_cfg, script, duration_s, speedup);
+    } else {
+        FlightDisplay display(1000, 800, "Leonardo Flight System - Manual Control");
 
-                    // Variabile MAGICA per regolare lo spostamento nello spazio senza toccare la velocità
-                    float physics_scale = 0.015f;
+        // fotografia iniziale prima che parta la fisica, così il primo frame ha già qualcosa da disegnare
+        PhysicsSnapshot first{};
+        first.prev.altitude = first.curr.altitude = 4000.0f;
+        first.t_curr_ns = monotonic_ns();
+        physics_snapshot.store(first);
 
-                    Aereo.x += std::sin(Aereo.yaw) * speed_orizzontale * physics_scale;
-                    Aereo.z += std::cos(Aereo.yaw) * speed_orizzontale * physics_scale;
+        std::thread physics(physics_task, physics_cfg);
+        const float period_ns = 1e9f / physics_cfg.rate_hz;
 
-                    // Altitudine gestita dal moltiplicatore che hai scelto (0.2f o modificalo a piacimento)
-                    Aereo.altitude += speed_verticale * 0.2f;
+        PhysicsSnapshot snap = first; // ultima fotografia letta per intero
+        PhysicsSnapshot next;
+        uint64_t snap_seq;
 
-                    if (Aereo.altitude < 0) Aereo.altitude = 0.0f; // Pavimento assoluto
+        while (display.IsActive()) {
 
-                    if(Aereo.roll > 3.2f)  Aereo.roll = 3.2f;
-                    if(Aereo.roll < -3.2f) Aereo.roll = -3.2f;
-                    if(Aereo.pitch > 1.5f) Aereo.pitch = 1.5f;
-                    if(Aereo.pitch < -1.5f) Aereo.pitch = -1.5f;
+            // 1. LEGGE I COMANDI (Nessuna fisica qui, solo input utente)
+            pilot_input.store(display.ReadInput());
 
+            // 2. ultima fotografia della fisica: il passo dura pochi microsecondi, i tentativi falliti sono rari.
+            //    Qualche tentativo e poi si tiene quella del frame prima, il render non gira mai a vuoto
+            for (int attempt = 0; attempt < SNAPSHOT_LOAD_ATTEMPTS; attempt++) {
+                if (physics_snapshot.try_load(next, snap_seq)) {
+                    snap = next;
+                    break;
+                }
+            }
 
-            bus.write(packet_id++, Aereo.roll, Aereo.pitch, Aereo.yaw, Aereo.altitude, (recovery_low || recovery_high),Aereo.speed,Aereo.x,Aereo.z,recovery_bank);
+            // disegno un periodo indietro, fra il passo precedente e l'ultimo
+            float alpha = (monotonic_ns() - snap.t_curr_ns) / period_ns;
+            if (alpha < 0.0f) alpha = 0.0f;
+            if (alpha > 1.0f) alpha = 1.0f;
 
-            display.Draw(Aereo);
+            display.Draw(interpolate_plane(snap.prev, snap.curr, alpha));
         }
 
-        // chiudo il programma
-        {
-            std::lock_guard<std::mutex> lock(Aereo_mutex);
-            Aereo.system_active = false;
-        }
+        // chiudo il programma: prima la fisica, che è l'unica a scrivere sul bus
+        physics_running.store(false);
+        physics.join();
+        physics_stats.print("FISICA", 1000000L / physics_cfg.rate_hz);
+    }
 
-        if (Pilota_dds.joinable()) Pilota_dds.join();
+    if (input_recorder) input_recorder->close();
 
-        return 0;
+        // sveglia il computer di volo (thread o processo FlightComputer) che così può uscire subito
+        bus.shutdown();
+#if !defined(FLIGHT_BUS_POSIX_SHM)
+        if (Pilota_dds.joinable()) Pilota_dds.join();
+        // risposta del computer di volo per frame: con --async-publish senza la write DDS
+        std::printf("[DDS] frame: %ld | risposta media: %.2f us | max: %.2f us%s\n", fc_response.samples,
+                    fc_response.avg_us(), fc_response.max_us, stage ? " (pubblicazione asincrona)" : "");
+        if (stage) {
+            stage->shutdown();
+            stage->print_counters("DDS");
+        }
+#endif
+#if defined(FLIGHT_BUS_BROADCAST)
+        recorder.join();
+        health.join();
+        dds_reader.print_counters();
+        recorder_reader.print_counters();
+        health_reader.print_counters();
+#elif !defined(FLIGHT_BUS_POSIX_SHM)
+        // stampo la latenza del bus per confrontare mutex e seqlock
+        bus.latency().print(bus.name);
+#endif
+#if defined(FLIGHT_BUS_RING)
+        bus.print_counters();
+#elif !defined(FLIGHT_BUS_SEQLOCK) && !defined(FLIGHT_BUS_BROADCAST)
+        std::cout << "[BUS " << bus.name << "] campioni sovrascritti: " << bus.overwritten() << std::endl;
+#endif
+
+        return replay_ok ? 0 : 2;
 }